@@ -4926,6 +4926,8 @@ static int ipa3_q6_clean_q6_tables(void)
 
 	IPADBG("Entry\n");
 
+	/* Q6 pipe entries in the FLT/RT headers are rewritten below */
+	ipa3_fltrt_shadow_invalidate();
 
 	if (ipa3_q6_clean_q6_flt_tbls(IPA_IP_v4, IPA_RULE_HASHABLE)) {
 		IPAERR("failed to clean q6 flt tbls (v4/hashable)\n");
@@ -5273,6 +5275,9 @@ void ipa3_q6_post_shutdown_cleanup(void)
 
 	IPADBG_LOW("ENTER\n");
 
+	/* SRAM contents are not trusted across a modem SSR */
+	ipa3_fltrt_shadow_invalidate();
+
 	IPA_ACTIVE_CLIENTS_INC_SIMPLE();
 
 	/* Handle the issue where SUSPEND was removed for some reason */
@@ -5398,6 +5403,9 @@ int _ipa_init_sram_v3(void)
 	u32 *ipa_sram_mmio;
 	unsigned long phys_addr;
 
+	/* SRAM is re-initialized below, no commit may skip a region */
+	ipa3_fltrt_shadow_invalidate();
+
 	IPADBG(
 	    "ipa_wrapper_base(0x%08X) ipa_reg_base_ofst(0x%08X) IPA_SW_AREA_RAM_DIRECT_ACCESS_n(0x%08X) smem_restricted_bytes(0x%08X) smem_sz(0x%08X)\n",
 	    ipa3_ctx->ipa_wrapper_base,
@@ -9378,6 +9386,7 @@ static int ipa3_pre_init(const struct ipa3_plat_drv_res *resource_p,
 		   sizeof(ipa3_ctx->flt_rt_counters.used_sw));
 
 	INIT_LIST_HEAD(&ipa3_ctx->intf_list);
+	init_llist_head(&ipa3_ctx->msg_llist);
 	INIT_LIST_HEAD(&ipa3_ctx->msg_list);
 	INIT_LIST_HEAD(&ipa3_ctx->pull_msg_list);
 	init_waitqueue_head(&ipa3_ctx->msg_waitq);
@@ -12032,6 +12041,7 @@ static void __exit ipa_module_exit(void)
 		kfree(ipa3_ctx->hw_stats);
 		ipa3_ctx->hw_stats = NULL;
 	}
+	ipa3_fltrt_shadow_free();
 	unregister_pm_notifier(&ipa_pm_notifier);
 	kfree(ipa3_ctx);
 	ipa3_ctx = NULL;
@@ -1610,6 +1610,18 @@ static ssize_t ipa3_read_odlstats(struct file *file, char __user *ubuf,
 }
 
 
+static u64 ipa3_page_recycle_hit_rate(int i)
+{
+	struct ipa3_page_recycle_stats *stats =
+		&ipa3_ctx->stats.page_recycle_stats[i];
+
+	if (!stats->total_replenished)
+		return 0;
+
+	return div64_u64(stats->page_recycled * 100,
+		stats->total_replenished);
+}
+
 static ssize_t ipa3_read_page_recycle_stats(struct file *file,
 		char __user *ubuf, size_t count, loff_t *ppos)
 {
@@ -1626,7 +1638,15 @@ static ssize_t ipa3_read_page_recycle_stats(struct file *file,
 			"DEF  : Number of tmp alloc packets  =%llu\n"
 			"DEF  : Number of times tasklet scheduled  =%llu\n"
 			"COMMON  : Number of page recycled in tasklet  =%llu\n"
-			"COMMON  : Number of times free pages not found in tasklet =%llu\n",
+			"COMMON  : Number of times free pages not found in tasklet =%llu\n"
+			"COAL : Recycle hit rate (percent) =%llu\n"
+			"COAL : Number of bulk refills =%llu\n"
+			"COAL : Number of bulk refills with no free page =%llu\n"
+			"COAL : Total recycle list entries scanned =%llu\n"
+			"DEF  : Recycle hit rate (percent) =%llu\n"
+			"DEF  : Number of bulk refills =%llu\n"
+			"DEF  : Number of bulk refills with no free page =%llu\n"
+			"DEF  : Total recycle list entries scanned =%llu\n",
 			ipa3_ctx->stats.page_recycle_stats[0].total_replenished,
 			ipa3_ctx->stats.page_recycle_stats[0].page_recycled,
 			ipa3_ctx->stats.page_recycle_stats[0].tmp_alloc,
@@ -1636,7 +1656,15 @@ static ssize_t ipa3_read_page_recycle_stats(struct file *file,
 			ipa3_ctx->stats.page_recycle_stats[1].tmp_alloc,
 			ipa3_ctx->stats.num_sort_tasklet_sched[1],
 			ipa3_ctx->stats.page_recycle_cnt_in_tasklet,
-			ipa3_ctx->stats.num_of_times_wq_reschd);
+			ipa3_ctx->stats.num_of_times_wq_reschd,
+			ipa3_page_recycle_hit_rate(0),
+			ipa3_ctx->stats.page_recycle_stats[0].bulk_refill,
+			ipa3_ctx->stats.page_recycle_stats[0].bulk_miss,
+			ipa3_ctx->stats.page_recycle_stats[0].scan_len,
+			ipa3_page_recycle_hit_rate(1),
+			ipa3_ctx->stats.page_recycle_stats[1].bulk_refill,
+			ipa3_ctx->stats.page_recycle_stats[1].bulk_miss,
+			ipa3_ctx->stats.page_recycle_stats[1].scan_len);
 
 	cnt += nbytes;
 
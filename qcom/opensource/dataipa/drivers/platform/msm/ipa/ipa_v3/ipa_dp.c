@@ -92,8 +92,6 @@
 
 #define IPA_APPS_BW_FOR_PM 700
 
-#define IPA_SEND_MAX_DESC (20)
-
 #define IPA_EOT_THRESH 32
 
 #define IPA_QMAP_ID_BYTE 0
@@ -2709,36 +2707,50 @@ static inline void __trigger_repl_work(struct ipa3_sys_context *sys)
 	}
 }
 
-static struct ipa3_rx_pkt_wrapper * ipa3_get_free_page
-(
-	struct ipa3_sys_context *sys,
-	u32 stats_i
-)
+/*
+ * Grab up to @max idle pages from the recycle list under a single lock
+ * hold. Pages still held by the stack are rotated to the tail as they
+ * are passed over, so the head of the list converges towards pages
+ * that are ready and the next scan does not retry the same busy ones.
+ * The scan gives up after page_poll_threshold busy pages.
+ */
+static u32 ipa3_get_free_pages(struct ipa3_sys_context *sys, u32 stats_i,
+	struct ipa3_rx_pkt_wrapper **pkts, u32 max)
 {
-	struct ipa3_rx_pkt_wrapper *rx_pkt = NULL;
-	struct ipa3_rx_pkt_wrapper *tmp = NULL;
+	struct ipa3_page_recycle_stats *stats =
+		&ipa3_ctx->stats.page_recycle_stats[stats_i];
+	struct list_head *head = &sys->page_recycle_repl->page_repl_head;
+	struct ipa3_rx_pkt_wrapper *rx_pkt;
 	struct page *cur_page;
-	int i = 0;
-	u8 LOOP_THRESHOLD = ipa3_ctx->page_poll_threshold;
+	u32 busy = 0, scanned = 0, found = 0;
+	u32 LOOP_THRESHOLD = ipa3_ctx->page_poll_threshold;
 
 	spin_lock_bh(&sys->common_sys->spinlock);
-	list_for_each_entry_safe(rx_pkt, tmp,
-		&sys->page_recycle_repl->page_repl_head, link) {
-		if (i == LOOP_THRESHOLD)
-			break;
+	while (found < max && busy < LOOP_THRESHOLD && !list_empty(head)) {
+		rx_pkt = list_first_entry(head, struct ipa3_rx_pkt_wrapper, link);
 		cur_page = rx_pkt->page_data.page;
+		scanned++;
 		if (page_ref_count(cur_page) == 1) {
 			/* Found a free page. */
 			page_ref_inc(cur_page);
 			list_del_init(&rx_pkt->link);
-			++ipa3_ctx->stats.page_recycle_cnt[stats_i][i];
-			sys->common_sys->napi_sort_page_thrshld_cnt = 0;
-			spin_unlock_bh(&sys->common_sys->spinlock);
-			return rx_pkt;
+			++ipa3_ctx->stats.page_recycle_cnt[stats_i][busy];
+			pkts[found++] = rx_pkt;
+		} else {
+			list_move_tail(&rx_pkt->link, head);
+			busy++;
 		}
-		i++;
 	}
+	if (found)
+		sys->common_sys->napi_sort_page_thrshld_cnt = 0;
 	spin_unlock_bh(&sys->common_sys->spinlock);
+
+	stats->bulk_refill++;
+	stats->scan_len += scanned;
+	if (found)
+		return found;
+
+	stats->bulk_miss++;
 	IPADBG_LOW("napi_sort_page_thrshld_cnt = %d ipa_max_napi_sort_page_thrshld = %d\n",
 			sys->common_sys->napi_sort_page_thrshld_cnt,
 			ipa3_ctx->ipa_max_napi_sort_page_thrshld);
@@ -2749,7 +2761,7 @@ static struct ipa3_rx_pkt_wrapper * ipa3_get_free_page
 		tasklet_schedule(&sys->common_sys->tasklet_find_freepage);
 		++ipa3_ctx->stats.num_sort_tasklet_sched[stats_i];
 	}
-	return NULL;
+	return 0;
 }
 
 int ipa3_register_notifier(void *fn_ptr)
@@ -2798,6 +2810,9 @@ static void ipa3_replenish_rx_page_recycle(struct ipa3_sys_context *sys)
 	u32 curr_wq;
 	int idx = 0;
 	u32 stats_i = 0;
+	struct ipa3_rx_pkt_wrapper *free_pkts[IPA_REPL_XFER_MAX];
+	u32 free_cnt = 0, free_idx = 0;
+	bool recycle = true;
 
 	/* start replenish only when buffers go lower than the threshold */
 	if (sys->rx_pool_sz - sys->len < IPA_REPL_XFER_THRESH)
@@ -2820,9 +2835,19 @@ static void ipa3_replenish_rx_page_recycle(struct ipa3_sys_context *sys)
 	curr_wq = atomic_read(&sys->repl->head_idx);
 
 	while (rx_len_cached < sys->rx_pool_sz) {
-		/* check for an idle page that can be used */
-		if (atomic_read(&sys->common_sys->page_avilable) &&
-			((rx_pkt = ipa3_get_free_page(sys,stats_i)) != NULL)) {
+		/* refill the local batch of idle pages once it runs dry */
+		if (free_idx == free_cnt && recycle &&
+			atomic_read(&sys->common_sys->page_avilable)) {
+			free_cnt = ipa3_get_free_pages(sys, stats_i, free_pkts,
+				min_t(u32, IPA_REPL_XFER_MAX,
+					sys->rx_pool_sz - rx_len_cached));
+			free_idx = 0;
+			/* do not rescan a list that just came up empty */
+			recycle = free_cnt != 0;
+		}
+
+		if (free_idx < free_cnt) {
+			rx_pkt = free_pkts[free_idx++];
 			ipa3_ctx->stats.page_recycle_stats[stats_i].page_recycled++;
 
 		} else {
@@ -4720,7 +4745,10 @@ static void ipa3_rx_napi_chain(struct ipa3_sys_context *sys,
 					sys->pyld_hdlr(rx_skb, sys);
 					/*
 					 * For coalescing, we have 2 transfer
-					 * rings to replenish
+					 * rings to replenish. ipa3_rx_poll()
+					 * refills both and rings the doorbell
+					 * once per batch, only top up here if
+					 * a ring is running low.
 					 */
 					ipa_ep_idx = ipa3_get_ep_mapping(
 						IPA_CLIENT_APPS_WAN_CONS);
@@ -4731,6 +4759,11 @@ static void ipa3_rx_napi_chain(struct ipa3_sys_context *sys,
 					}
 					wan_def_sys =
 						ipa3_ctx->ep[ipa_ep_idx].sys;
+					if (sys->len >
+						IPA_DEFAULT_SYS_YELLOW_WM &&
+						wan_def_sys->len >
+						IPA_DEFAULT_SYS_YELLOW_WM)
+						continue;
 					wan_def_sys->repl_hdlr(wan_def_sys);
 					sys->repl_hdlr(sys);
 				}
@@ -232,12 +232,6 @@ static int ipa_translate_flt_tbl_to_hw_fmt(enum ipa_ip_type ip,
 				goto err;
 			}
 
-			if (ipahal_fltrt_write_addr_to_hdr(tbl_mem.phys_base,
-				hdr, hdr_idx, true)) {
-				IPAERR("fail to wrt sys tbl addr to hdr\n");
-				goto hdr_update_fail;
-			}
-
 			tbl_mem_buf = tbl_mem.base;
 
 			/* generate the rule-set */
@@ -254,6 +248,30 @@ static int ipa_translate_flt_tbl_to_hw_fmt(enum ipa_ip_type ip,
 				tbl_mem_buf += entry->hw_len;
 			}
 
+			/*
+			 * Keep the table HW already uses if it did not change,
+			 * so its header entry stays the same and is not
+			 * written again.
+			 */
+			if (ipa3_fltrt_sys_tbl_unchanged(&tbl->curr_mem[rlt],
+				&tbl_mem)) {
+				ipahal_free_dma_mem(&tbl_mem);
+				if (ipahal_fltrt_write_addr_to_hdr(
+					tbl->curr_mem[rlt].phys_base,
+					hdr, hdr_idx, true)) {
+					IPAERR("fail to wrt sys tbl addr to hdr\n");
+					goto err;
+				}
+				hdr_idx++;
+				continue;
+			}
+
+			if (ipahal_fltrt_write_addr_to_hdr(tbl_mem.phys_base,
+				hdr, hdr_idx, true)) {
+				IPAERR("fail to wrt sys tbl addr to hdr\n");
+				goto hdr_update_fail;
+			}
+
 			if (tbl->curr_mem[rlt].phys_base) {
 				WARN_ON(tbl->prev_mem[rlt].phys_base);
 				tbl->prev_mem[rlt] = tbl->curr_mem[rlt];
@@ -499,6 +517,8 @@ int __ipa_commit_flt_v3(enum ipa_ip_type ip)
 	struct ipa3_flt_tbl_nhash_lcl *lcl_tbl;
 	u16 entries;
 	struct ipahal_imm_cmd_register_write reg_write_coal_close;
+	struct ipa3_fltrt_shadow *sh = &ipa3_ctx->flt_shadow[ip];
+	int num_dma = 0;
 
 	tbl_hdr_width = ipahal_get_hw_tbl_hdr_width();
 	memset(&alloc_params, 0, sizeof(alloc_params));
@@ -601,6 +621,8 @@ int __ipa_commit_flt_v3(enum ipa_ip_type ip)
 		goto prep_failed;
 	}
 
+	ipa3_fltrt_shadow_begin(sh);
+
 	/* +4: 2 for bodies (hashable and non-hashable), 1 for flushing and 1
 	 * for closing the colaescing frame
 	 */
@@ -708,6 +730,14 @@ int __ipa_commit_flt_v3(enum ipa_ip_type ip)
 		IPADBG_LOW("Prepare imm cmd for hdr at index %d for pipe %d\n",
 			hdr_idx, i);
 
+		/* Only pipes whose header entry changed are written */
+		if (!ipa3_fltrt_shadow_changed(sh,
+			&sh->hdr[IPA_RULE_NON_HASHABLE],
+			hdr_idx * tbl_hdr_width,
+			alloc_params.nhash_hdr.base + hdr_idx * tbl_hdr_width,
+			tbl_hdr_width))
+			goto nhash_hdr_done;
+
 		mem_cmd.is_read = false;
 		mem_cmd.skip_pipeline_clear = false;
 		mem_cmd.pipeline_clear_options = IPAHAL_HPS_CLEAR;
@@ -726,12 +756,20 @@ int __ipa_commit_flt_v3(enum ipa_ip_type ip)
 		}
 		ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
 		++num_cmd;
+		++num_dma;
 
+nhash_hdr_done:
 		/*
 		 * SRAM memory not allocated to hash tables. Sending command
 		 * to hash tables(filer/routing) operation not supported.
 		 */
-		if (!ipa3_ctx->ipa_fltrt_not_hashable) {
+		if (!ipa3_ctx->ipa_fltrt_not_hashable &&
+			ipa3_fltrt_shadow_changed(sh,
+				&sh->hdr[IPA_RULE_HASHABLE],
+				hdr_idx * tbl_hdr_width,
+				alloc_params.hash_hdr.base +
+				hdr_idx * tbl_hdr_width,
+				tbl_hdr_width)) {
 			mem_cmd.is_read = false;
 			mem_cmd.skip_pipeline_clear = false;
 			mem_cmd.pipeline_clear_options = IPAHAL_HPS_CLEAR;
@@ -753,11 +791,15 @@ int __ipa_commit_flt_v3(enum ipa_ip_type ip)
 			ipa3_init_imm_cmd_desc(&desc[num_cmd],
 						cmd_pyld[num_cmd]);
 			++num_cmd;
+			++num_dma;
 		}
 		++hdr_idx;
 	}
 
-	if (lcl_nhash && alloc_params.num_lcl_nhash_tbls > 0) {
+	if (lcl_nhash && alloc_params.num_lcl_nhash_tbls > 0 &&
+		ipa3_fltrt_shadow_changed(sh, &sh->bdy[IPA_RULE_NON_HASHABLE],
+			0, alloc_params.nhash_bdy.base,
+			alloc_params.nhash_bdy.size)) {
 		if (num_cmd >= entries) {
 			IPAERR("number of commands is out of range: IP = %d\n",
 				ip);
@@ -781,8 +823,11 @@ int __ipa_commit_flt_v3(enum ipa_ip_type ip)
 		}
 		ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
 		++num_cmd;
+		++num_dma;
 	}
-	if (lcl_hash) {
+	if (lcl_hash && ipa3_fltrt_shadow_changed(sh,
+		&sh->bdy[IPA_RULE_HASHABLE], 0, alloc_params.hash_bdy.base,
+		alloc_params.hash_bdy.size)) {
 		if (num_cmd >= entries) {
 			IPAERR("number of commands is out of range: IP = %d\n",
 				ip);
@@ -806,9 +851,11 @@ int __ipa_commit_flt_v3(enum ipa_ip_type ip)
 		}
 		ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
 		++num_cmd;
+		++num_dma;
 	}
 
-	remaining_num_cmd = num_cmd;
+	/* Nothing changed in SRAM, no need to close coal or flush */
+	remaining_num_cmd = num_dma ? num_cmd : 0;
 	desc_to_send = desc;
 
 	/*
@@ -853,6 +900,7 @@ int __ipa_commit_flt_v3(enum ipa_ip_type ip)
 
 	__ipa_reap_sys_flt_tbls(ip, IPA_RULE_HASHABLE);
 	__ipa_reap_sys_flt_tbls(ip, IPA_RULE_NON_HASHABLE);
+	ipa3_fltrt_shadow_end(sh);
 
 fail_imm_cmd_construct:
 	for (i = 0 ; i < num_cmd ; i++)
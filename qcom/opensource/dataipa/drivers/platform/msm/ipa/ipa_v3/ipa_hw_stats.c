@@ -44,6 +44,7 @@ int ipa_hw_stats_init(void)
 	}
 
 	/* initialize stats here */
+	mutex_init(&ipa3_ctx->hw_stats->snapshot_lock);
 	ipa3_ctx->hw_stats->enabled = true;
 
 	/* for IPA_HW_v5_0, reserved teth_stats sram for flt-tbls */
@@ -492,7 +493,7 @@ static bool ipa_validate_quota_stats_sram_size(u32 needed_len)
 	return true;
 }
 
-int ipa_init_quota_stats(u32 *pipe_bitmask)
+static int __ipa_init_quota_stats(u32 *pipe_bitmask)
 {
 	struct ipahal_stats_init_pyld *pyld;
 	struct ipahal_imm_cmd_dma_shared_mem cmd = { 0 };
@@ -674,46 +675,135 @@ destroy_init_pyld:
 	return ret;
 }
 
-int ipa_get_quota_stats(struct ipa_quota_stats_all *out)
+/*
+ * The SRAM layout changes under a running snapshot otherwise. Hold
+ * snapshot_lock across the re-init so a concurrent query can not cache a
+ * snapshot of the old layout.
+ */
+int ipa_init_quota_stats(u32 *pipe_bitmask)
 {
-	int i;
 	int ret;
-	struct ipahal_stats_get_offset_quota get_offset = { { 0 } };
-	struct ipahal_stats_offset offset = { 0 };
-	struct ipahal_imm_cmd_dma_shared_mem cmd = { 0 };
-	struct ipahal_imm_cmd_pyld *cmd_pyld[2];
-	struct ipa_mem_buffer mem;
-	struct ipa3_desc desc[2];
-	struct ipahal_stats_quota_all *stats;
-	int num_cmd = 0;
 
 	if (!(ipa3_ctx->hw_stats && ipa3_ctx->hw_stats->enabled))
 		return 0;
 
+	mutex_lock(&ipa3_ctx->hw_stats->snapshot_lock);
+	ipa3_ctx->hw_stats->snapshot_valid = false;
+	ret = __ipa_init_quota_stats(pipe_bitmask);
+	mutex_unlock(&ipa3_ctx->hw_stats->snapshot_lock);
+
+	return ret;
+}
+
+enum ipa_hw_stats_region {
+	IPA_HW_STATS_REGION_QUOTA,
+	IPA_HW_STATS_REGION_TETH,
+	IPA_HW_STATS_REGION_DROP,
+	IPA_HW_STATS_REGION_MAX
+};
+
+static int ipa_hw_stats_region_offset(enum ipa_hw_stats_region region,
+	struct ipahal_stats_offset *offset, u32 *part_ofst)
+{
+	struct ipahal_stats_get_offset_quota get_quota = { { 0 } };
+	struct ipahal_stats_get_offset_tethering get_teth;
+	struct ipahal_stats_get_offset_drop get_drop = { { 0 } };
+
+	switch (region) {
+	case IPA_HW_STATS_REGION_QUOTA:
+		get_quota.init = ipa3_ctx->hw_stats->quota.init;
+		*part_ofst = IPA_MEM_PART(stats_quota_ap_ofst);
+		return ipahal_stats_get_offset(IPAHAL_HW_STATS_QUOTA,
+			&get_quota, offset);
+	case IPA_HW_STATS_REGION_TETH:
+		memset(&get_teth, 0, sizeof(get_teth));
+		get_teth.init = ipa3_ctx->hw_stats->teth.init;
+		*part_ofst = IPA_MEM_PART(stats_tethering_ofst);
+		return ipahal_stats_get_offset(IPAHAL_HW_STATS_TETHERING,
+			&get_teth, offset);
+	case IPA_HW_STATS_REGION_DROP:
+		get_drop.init = ipa3_ctx->hw_stats->drop.init;
+		*part_ofst = IPA_MEM_PART(stats_drop_ofst);
+		return ipahal_stats_get_offset(IPAHAL_HW_STATS_DROP,
+			&get_drop, offset);
+	default:
+		return -EINVAL;
+	}
+}
+
+/*
+ * Read (and clear) the requested stats regions from SRAM with a single
+ * immediate command chain. Regions which are back to back in SRAM are
+ * read by a single DMA. On return base[] points into @mem for every
+ * region still set in want[].
+ */
+static int ipa_hw_stats_read_regions(bool *want, void **base,
+	struct ipa_mem_buffer *mem)
+{
+	struct ipahal_stats_offset offset[IPA_HW_STATS_REGION_MAX];
+	struct ipahal_imm_cmd_dma_shared_mem cmd = { 0 };
+	struct ipahal_imm_cmd_pyld *cmd_pyld[IPA_HW_STATS_REGION_MAX + 1];
+	struct ipa3_desc desc[IPA_HW_STATS_REGION_MAX + 1];
+	u32 span_local[IPA_HW_STATS_REGION_MAX];
+	u32 span_buf[IPA_HW_STATS_REGION_MAX];
+	u32 span_size[IPA_HW_STATS_REGION_MAX];
+	u32 buf_ofst[IPA_HW_STATS_REGION_MAX];
+	u32 local, part_ofst, size = 0;
+	int num_span = 0;
+	int num_cmd = 0;
+	int ret, r, i;
+
 	memset(desc, 0, sizeof(desc));
 	memset(cmd_pyld, 0, sizeof(cmd_pyld));
+	memset(offset, 0, sizeof(offset));
 
-	get_offset.init = ipa3_ctx->hw_stats->quota.init;
-	ret = ipahal_stats_get_offset(IPAHAL_HW_STATS_QUOTA, &get_offset,
-		&offset);
-	if (ret) {
-		IPAERR("failed to get offset from hal %d\n", ret);
-		return ret;
-	}
+	for (r = 0; r < IPA_HW_STATS_REGION_MAX; r++) {
+		if (!want[r])
+			continue;
+
+		ret = ipa_hw_stats_region_offset(r, &offset[r], &part_ofst);
+		if (ret) {
+			IPAERR("failed to get offset from hal %d\n", ret);
+			return ret;
+		}
+
+		IPADBG_LOW("region %d offset = %d size = %d\n", r,
+			offset[r].offset, offset[r].size);
+
+		if (offset[r].size == 0) {
+			want[r] = false;
+			continue;
+		}
 
-	IPADBG_LOW("offset = %d size = %d\n", offset.offset, offset.size);
+		local = ipa3_ctx->smem_restricted_bytes + part_ofst +
+			offset[r].offset;
+		buf_ofst[r] = size;
+		if (num_span &&
+			span_local[num_span - 1] + span_size[num_span - 1] ==
+				local &&
+			span_buf[num_span - 1] + span_size[num_span - 1] ==
+				size) {
+			span_size[num_span - 1] += offset[r].size;
+		} else {
+			span_local[num_span] = local;
+			span_buf[num_span] = size;
+			span_size[num_span] = offset[r].size;
+			num_span++;
+		}
+		size += offset[r].size;
+	}
 
-	if (offset.size == 0)
+	if (!size)
 		return 0;
 
-	mem.size = offset.size;
-	mem.base = dma_alloc_coherent(ipa3_ctx->pdev,
-		mem.size,
-		&mem.phys_base,
+	mem->size = size;
+	mem->base = dma_alloc_coherent(ipa3_ctx->pdev,
+		mem->size,
+		&mem->phys_base,
 		GFP_KERNEL);
-	if (!mem.base) {
-		IPAERR("fail to alloc DMA memory");
-		return ret;
+	if (!mem->base) {
+		IPAERR("fail to alloc DMA memory\n");
+		return -ENOMEM;
 	}
 
 	/* IC to close the coal frame before HPS Clear if coal is enabled */
@@ -729,23 +819,24 @@ int ipa_get_quota_stats(struct ipa_quota_stats_all *out)
 		++num_cmd;
 	}
 
-	cmd.is_read = true;
-	cmd.clear_after_read = true;
-	cmd.skip_pipeline_clear = false;
-	cmd.pipeline_clear_options = IPAHAL_HPS_CLEAR;
-	cmd.size = mem.size;
-	cmd.system_addr = mem.phys_base;
-	cmd.local_addr = ipa3_ctx->smem_restricted_bytes +
-		IPA_MEM_PART(stats_quota_ap_ofst) + offset.offset;
-	cmd_pyld[num_cmd] = ipahal_construct_imm_cmd(
-		IPA_IMM_CMD_DMA_SHARED_MEM, &cmd, false);
-	if (!cmd_pyld[num_cmd]) {
-		IPAERR("failed to construct dma_shared_mem imm cmd\n");
-		ret = -ENOMEM;
-		goto free_dma_mem;
+	for (i = 0; i < num_span; i++) {
+		cmd.is_read = true;
+		cmd.clear_after_read = true;
+		cmd.skip_pipeline_clear = false;
+		cmd.pipeline_clear_options = IPAHAL_HPS_CLEAR;
+		cmd.size = span_size[i];
+		cmd.system_addr = mem->phys_base + span_buf[i];
+		cmd.local_addr = span_local[i];
+		cmd_pyld[num_cmd] = ipahal_construct_imm_cmd(
+			IPA_IMM_CMD_DMA_SHARED_MEM, &cmd, false);
+		if (!cmd_pyld[num_cmd]) {
+			IPAERR("failed to construct dma_shared_mem imm cmd\n");
+			ret = -ENOMEM;
+			goto destroy_imm;
+		}
+		ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
+		++num_cmd;
 	}
-	ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
-	++num_cmd;
 
 	ret = ipa3_send_cmd(num_cmd, desc);
 	if (ret) {
@@ -753,14 +844,36 @@ int ipa_get_quota_stats(struct ipa_quota_stats_all *out)
 		goto destroy_imm;
 	}
 
+	for (r = 0; r < IPA_HW_STATS_REGION_MAX; r++)
+		if (want[r])
+			base[r] = (u8 *)mem->base + buf_ofst[r];
+
+	for (i = 0; i < num_cmd; i++)
+		ipahal_destroy_imm_cmd(cmd_pyld[i]);
+	return 0;
+
+destroy_imm:
+	for (i = 0; i < num_cmd; i++)
+		ipahal_destroy_imm_cmd(cmd_pyld[i]);
+free_dma_mem:
+	dma_free_coherent(ipa3_ctx->pdev, mem->size, mem->base,
+		mem->phys_base);
+	mem->base = NULL;
+	return ret;
+}
+
+static int ipa_hw_stats_parse_quota(void *base)
+{
+	struct ipahal_stats_quota_all *stats;
+	int ret;
+	int i;
+
 	stats = kzalloc(sizeof(*stats), GFP_KERNEL);
-	if (!stats) {
-		ret = -ENOMEM;
-		goto destroy_imm;
-	}
+	if (!stats)
+		return -ENOMEM;
 
 	ret = ipahal_parse_stats(IPAHAL_HW_STATS_QUOTA,
-		&ipa3_ctx->hw_stats->quota.init, mem.base, stats);
+		&ipa3_ctx->hw_stats->quota.init, base, stats);
 	if (ret) {
 		IPAERR("failed to parse stats (error %d)\n", ret);
 		goto free_stats;
@@ -790,19 +903,249 @@ int ipa_get_quota_stats(struct ipa_quota_stats_all *out)
 			stats->stats[ep_idx].num_ipv6_pkts;
 	}
 
-	/* copy results to out parameter */
-	if (out)
-		*out = ipa3_ctx->hw_stats->quota.stats;
-	ret = 0;
 free_stats:
 	kfree(stats);
-destroy_imm:
-	for (i = 0; i < num_cmd; i++)
-		ipahal_destroy_imm_cmd(cmd_pyld[i]);
-free_dma_mem:
-	dma_free_coherent(ipa3_ctx->pdev, mem.size, mem.base, mem.phys_base);
 	return ret;
+}
+
+static int ipa_hw_stats_parse_teth(void *base)
+{
+	int i, j;
+	int prod_reg, cons_reg;
+	int ret;
+	struct ipahal_stats_tethering_all *stats_all;
+	struct ipa_hw_stats_teth *sw_stats;
+	struct ipahal_stats_tethering *stats;
+	struct ipa_quota_stats *quota_stats;
+	struct ipahal_stats_init_tethering *init;
+
+	sw_stats = &ipa3_ctx->hw_stats->teth;
+	init = (struct ipahal_stats_init_tethering *)
+			&ipa3_ctx->hw_stats->teth.init;
+
+	stats_all = kzalloc(sizeof(*stats_all), GFP_KERNEL);
+	if (!stats_all) {
+		IPADBG("failed to alloc memory\n");
+		return -ENOMEM;
+	}
+
+	ret = ipahal_parse_stats(IPAHAL_HW_STATS_TETHERING,
+		&ipa3_ctx->hw_stats->teth.init, base, stats_all);
+	if (ret) {
+		IPAERR("failed to parse stats_all (error %d)\n", ret);
+		goto free_stats;
+	}
+
+	/*
+	 * prod_stats holds what was read since the last ipa_get_teth_stats(),
+	 * start over once that caller has seen it
+	 */
+	if (ipa3_ctx->hw_stats->teth_consumed) {
+		for (i = 0; i < IPA_CLIENT_MAX; i++) {
+			memset(&sw_stats->prod_stats[i], 0,
+				sizeof(sw_stats->prod_stats[i]));
+		}
+		ipa3_ctx->hw_stats->teth_consumed = false;
+	}
+
+	/*
+	 * update driver cache.
+	 * the stats were read from hardware with clear_after_read meaning
+	 * hardware stats are 0 now
+	 */
+	for (i = 0; i < IPA_CLIENT_MAX; i++) {
+		for (j = 0; j < IPA_CLIENT_MAX; j++) {
+			int prod_idx = ipa3_get_ep_mapping(i);
+			int cons_idx = ipa3_get_ep_mapping(j);
+
+			if (prod_idx == -1 ||
+				prod_idx >= ipa3_get_max_num_pipes())
+				continue;
+
+			if (cons_idx == -1 ||
+				cons_idx >= ipa3_get_max_num_pipes())
+				continue;
+
+			prod_reg = ipahal_get_ep_reg_idx(prod_idx);
+			cons_reg = ipahal_get_ep_reg_idx(cons_idx);
+
+			/* save hw-query result */
+			if ((init->prod_bitmask[prod_reg] &
+				ipahal_get_ep_bit(prod_idx)) &&
+				(init->cons_bitmask[prod_idx][cons_reg]
+					& ipahal_get_ep_bit(cons_idx))) {
+				IPADBG_LOW("prod %d cons %d\n",
+					prod_idx, cons_idx);
+				stats = &stats_all->stats[prod_idx][cons_idx];
+				IPADBG_LOW("num_ipv4_bytes %lld\n",
+					stats->num_ipv4_bytes);
+				IPADBG_LOW("num_ipv4_pkts %lld\n",
+					stats->num_ipv4_pkts);
+				IPADBG_LOW("num_ipv6_pkts %lld\n",
+					stats->num_ipv6_pkts);
+				IPADBG_LOW("num_ipv6_bytes %lld\n",
+					stats->num_ipv6_bytes);
+
+				/* update stats*/
+				quota_stats =
+					&sw_stats->prod_stats[i].client[j];
+				quota_stats->num_ipv4_bytes +=
+					stats->num_ipv4_bytes;
+				quota_stats->num_ipv4_pkts +=
+					stats->num_ipv4_pkts;
+				quota_stats->num_ipv6_bytes +=
+					stats->num_ipv6_bytes;
+				quota_stats->num_ipv6_pkts +=
+					stats->num_ipv6_pkts;
+
+				/* Accumulated stats */
+				quota_stats =
+					&sw_stats->prod_stats_sum[i].client[j];
+				quota_stats->num_ipv4_bytes +=
+					stats->num_ipv4_bytes;
+				quota_stats->num_ipv4_pkts +=
+					stats->num_ipv4_pkts;
+				quota_stats->num_ipv6_bytes +=
+					stats->num_ipv6_bytes;
+				quota_stats->num_ipv6_pkts +=
+					stats->num_ipv6_pkts;
+			}
+		}
+	}
+
+free_stats:
+	kfree(stats_all);
+	return ret;
+}
 
+static int ipa_hw_stats_parse_drop(void *base)
+{
+	struct ipahal_stats_drop_all *stats;
+	int ret;
+	int i;
+
+	stats = kzalloc(sizeof(*stats), GFP_KERNEL);
+	if (!stats)
+		return -ENOMEM;
+
+	ret = ipahal_parse_stats(IPAHAL_HW_STATS_DROP,
+		&ipa3_ctx->hw_stats->drop.init, base, stats);
+	if (ret) {
+		IPAERR("failed to parse stats (error %d)\n", ret);
+		goto free_stats;
+	}
+
+	/*
+	 * update driver cache.
+	 * the stats were read from hardware with clear_after_read meaning
+	 * hardware stats are 0 now
+	 */
+	for (i = 0; i < IPA_CLIENT_MAX; i++) {
+		int ep_idx = ipa3_get_ep_mapping(i);
+
+		if (ep_idx == -1 || ep_idx >= ipa3_get_max_num_pipes())
+			continue;
+
+		if (ipa3_ctx->ep[ep_idx].client != i)
+			continue;
+
+		ipa3_ctx->hw_stats->drop.stats.client[i].drop_byte_cnt +=
+			stats->stats[ep_idx].drop_byte_cnt;
+		ipa3_ctx->hw_stats->drop.stats.client[i].drop_packet_cnt +=
+			stats->stats[ep_idx].drop_packet_cnt;
+	}
+
+free_stats:
+	kfree(stats);
+	return ret;
+}
+
+/*
+ * Refresh the quota, tethering and drop caches from one SRAM read unless
+ * the last snapshot is younger than snapshot_interval_ms.
+ * snapshot_lock must be held.
+ */
+static int __ipa_hw_stats_snapshot(bool force)
+{
+	struct ipa_hw_stats *hw_stats = ipa3_ctx->hw_stats;
+	bool want[IPA_HW_STATS_REGION_MAX];
+	void *base[IPA_HW_STATS_REGION_MAX] = { NULL };
+	struct ipa_mem_buffer mem = { 0 };
+	int ret = 0;
+
+	lockdep_assert_held(&hw_stats->snapshot_lock);
+
+	if (!force && hw_stats->snapshot_valid &&
+		hw_stats->snapshot_interval_ms &&
+		time_before(jiffies, hw_stats->snapshot_time +
+			msecs_to_jiffies(hw_stats->snapshot_interval_ms))) {
+		hw_stats->snapshot_cached_cnt++;
+		return 0;
+	}
+
+	want[IPA_HW_STATS_REGION_QUOTA] = true;
+	want[IPA_HW_STATS_REGION_TETH] = hw_stats->teth_stats_enabled;
+	want[IPA_HW_STATS_REGION_DROP] = true;
+
+	ret = ipa_hw_stats_read_regions(want, base, &mem);
+	if (ret)
+		return ret;
+
+	if (want[IPA_HW_STATS_REGION_QUOTA])
+		ret = ipa_hw_stats_parse_quota(base[IPA_HW_STATS_REGION_QUOTA]);
+	if (!ret && want[IPA_HW_STATS_REGION_TETH])
+		ret = ipa_hw_stats_parse_teth(base[IPA_HW_STATS_REGION_TETH]);
+	if (!ret && want[IPA_HW_STATS_REGION_DROP])
+		ret = ipa_hw_stats_parse_drop(base[IPA_HW_STATS_REGION_DROP]);
+
+	if (mem.base)
+		dma_free_coherent(ipa3_ctx->pdev, mem.size, mem.base,
+			mem.phys_base);
+
+	if (ret)
+		return ret;
+
+	hw_stats->snapshot_valid = true;
+	hw_stats->snapshot_time = jiffies;
+	hw_stats->snapshot_cnt++;
+	return 0;
+}
+
+/**
+ * ipa_hw_stats_snapshot() - refresh all HW stats caches at once
+ * @force: read SRAM even if the cached snapshot is still fresh
+ *
+ * Return: 0 on success, negative on failure
+ */
+int ipa_hw_stats_snapshot(bool force)
+{
+	int ret;
+
+	if (!(ipa3_ctx->hw_stats && ipa3_ctx->hw_stats->enabled))
+		return 0;
+
+	mutex_lock(&ipa3_ctx->hw_stats->snapshot_lock);
+	ret = __ipa_hw_stats_snapshot(force);
+	mutex_unlock(&ipa3_ctx->hw_stats->snapshot_lock);
+
+	return ret;
+}
+
+int ipa_get_quota_stats(struct ipa_quota_stats_all *out)
+{
+	int ret;
+
+	if (!(ipa3_ctx->hw_stats && ipa3_ctx->hw_stats->enabled))
+		return 0;
+
+	mutex_lock(&ipa3_ctx->hw_stats->snapshot_lock);
+	ret = __ipa_hw_stats_snapshot(false);
+	/* copy results to out parameter */
+	if (!ret && out)
+		*out = ipa3_ctx->hw_stats->quota.stats;
+	mutex_unlock(&ipa3_ctx->hw_stats->snapshot_lock);
+
+	return ret;
 }
 
 int ipa_reset_quota_stats(enum ipa_client_type client)
@@ -818,17 +1161,20 @@ int ipa_reset_quota_stats(enum ipa_client_type client)
 		return -EINVAL;
 	}
 
+	mutex_lock(&ipa3_ctx->hw_stats->snapshot_lock);
 	/* reading stats will reset them in hardware */
-	ret = ipa_get_quota_stats(NULL);
+	ret = __ipa_hw_stats_snapshot(true);
 	if (ret) {
-		IPAERR("ipa_get_quota_stats failed %d\n", ret);
-		return ret;
+		IPAERR("ipa_hw_stats_snapshot failed %d\n", ret);
+		goto unlock;
 	}
 
 	/* reset driver's cache */
 	stats = &ipa3_ctx->hw_stats->quota.stats.client[client];
 	memset(stats, 0, sizeof(*stats));
-	return 0;
+unlock:
+	mutex_unlock(&ipa3_ctx->hw_stats->snapshot_lock);
+	return ret;
 }
 
 int ipa_reset_all_quota_stats(void)
@@ -839,20 +1185,23 @@ int ipa_reset_all_quota_stats(void)
 	if (!(ipa3_ctx->hw_stats && ipa3_ctx->hw_stats->enabled))
 		return 0;
 
+	mutex_lock(&ipa3_ctx->hw_stats->snapshot_lock);
 	/* reading stats will reset them in hardware */
-	ret = ipa_get_quota_stats(NULL);
+	ret = __ipa_hw_stats_snapshot(true);
 	if (ret) {
-		IPAERR("ipa_get_quota_stats failed %d\n", ret);
-		return ret;
+		IPAERR("ipa_hw_stats_snapshot failed %d\n", ret);
+		goto unlock;
 	}
 
 	/* reset driver's cache */
 	stats = &ipa3_ctx->hw_stats->quota.stats;
 	memset(stats, 0, sizeof(*stats));
-	return 0;
+unlock:
+	mutex_unlock(&ipa3_ctx->hw_stats->snapshot_lock);
+	return ret;
 }
 
-int ipa_init_teth_stats(struct ipa_teth_stats_endpoints *in)
+static int __ipa_init_teth_stats(struct ipa_teth_stats_endpoints *in)
 {
 	struct ipahal_stats_init_pyld *pyld;
 	struct ipahal_imm_cmd_dma_shared_mem cmd = { 0 };
@@ -1061,202 +1410,60 @@ destroy_teth_mask:
 		if (teth_mask_pyld[i])
 			ipahal_destroy_imm_cmd(teth_mask_pyld[i]);
 	}
-destroy_coal_cmd:
-	if (coal_cmd_pyld)
-		ipahal_destroy_imm_cmd(coal_cmd_pyld);
-unmap:
-	dma_unmap_single(ipa3_ctx->pdev, dma_address, pyld->len, DMA_TO_DEVICE);
-destroy_init_pyld:
-	ipahal_destroy_stats_init_pyld(pyld);
-	return ret;
-}
-
-int ipa_get_teth_stats(void)
-{
-	int i, j;
-	int prod_reg, cons_reg;
-	int ret;
-	struct ipahal_stats_get_offset_tethering get_offset;
-	struct ipahal_stats_offset offset = {0};
-	struct ipahal_imm_cmd_dma_shared_mem cmd = { 0 };
-	struct ipahal_imm_cmd_pyld *cmd_pyld[2];
-	struct ipa_mem_buffer mem;
-	struct ipa3_desc desc[2];
-	struct ipahal_stats_tethering_all *stats_all;
-	struct ipa_hw_stats_teth *sw_stats;
-	struct ipahal_stats_tethering *stats;
-	struct ipa_quota_stats *quota_stats;
-	struct ipahal_stats_init_tethering *init;
-	int num_cmd = 0;
-
-	if (!(ipa3_ctx->hw_stats && ipa3_ctx->hw_stats->enabled &&
-		ipa3_ctx->hw_stats->teth_stats_enabled))
-		return 0;
-
-	sw_stats = &ipa3_ctx->hw_stats->teth;
-	init = (struct ipahal_stats_init_tethering *)
-			&ipa3_ctx->hw_stats->teth.init;
-
-	memset(desc, 0, sizeof(desc));
-	memset(cmd_pyld, 0, sizeof(cmd_pyld));
-	memset(&get_offset, 0, sizeof(get_offset));
-
-	get_offset.init = ipa3_ctx->hw_stats->teth.init;
-	ret = ipahal_stats_get_offset(IPAHAL_HW_STATS_TETHERING, &get_offset,
-		&offset);
-	if (ret) {
-		IPAERR("failed to get offset from hal %d\n", ret);
-		return ret;
-	}
-
-	IPADBG_LOW("offset = %d size = %d\n", offset.offset, offset.size);
-
-	if (offset.size == 0)
-		return 0;
-
-	mem.size = offset.size;
-	mem.base = dma_alloc_coherent(ipa3_ctx->pdev,
-		mem.size,
-		&mem.phys_base,
-		GFP_KERNEL);
-	if (!mem.base) {
-		IPAERR("fail to alloc DMA memory\n");
-		return ret;
-	}
-
-	/* IC to close the coal frame before HPS Clear if coal is enabled */
-	if (ipa3_get_ep_mapping(IPA_CLIENT_APPS_WAN_COAL_CONS) !=
-		IPA_EP_NOT_ALLOCATED && !ipa3_ctx->ulso_wa) {
-		ipa_close_coal_frame(&cmd_pyld[num_cmd]);
-		if (!cmd_pyld[num_cmd]) {
-			IPAERR("failed to construct coal close IC\n");
-			ret = -ENOMEM;
-			goto free_dma_mem;
-		}
-		ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
-		++num_cmd;
-	}
-
-	cmd.is_read = true;
-	cmd.clear_after_read = true;
-	cmd.skip_pipeline_clear = false;
-	cmd.pipeline_clear_options = IPAHAL_HPS_CLEAR;
-	cmd.size = mem.size;
-	cmd.system_addr = mem.phys_base;
-	cmd.local_addr = ipa3_ctx->smem_restricted_bytes +
-		IPA_MEM_PART(stats_tethering_ofst) + offset.offset;
-	cmd_pyld[num_cmd] = ipahal_construct_imm_cmd(
-		IPA_IMM_CMD_DMA_SHARED_MEM, &cmd, false);
-	if (!cmd_pyld[num_cmd]) {
-		IPAERR("failed to construct dma_shared_mem imm cmd\n");
-		ret = -ENOMEM;
-		goto destroy_imm;
-	}
-	ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
-	++num_cmd;
-
-	ret = ipa3_send_cmd(num_cmd, desc);
-	if (ret) {
-		IPAERR("failed to send immediate command (error %d)\n", ret);
-		goto destroy_imm;
-	}
-
-	stats_all = kzalloc(sizeof(*stats_all), GFP_KERNEL);
-	if (!stats_all) {
-		IPADBG("failed to alloc memory\n");
-		ret = -ENOMEM;
-		goto destroy_imm;
-	}
+destroy_coal_cmd:
+	if (coal_cmd_pyld)
+		ipahal_destroy_imm_cmd(coal_cmd_pyld);
+unmap:
+	dma_unmap_single(ipa3_ctx->pdev, dma_address, pyld->len, DMA_TO_DEVICE);
+destroy_init_pyld:
+	ipahal_destroy_stats_init_pyld(pyld);
+	return ret;
+}
 
-	ret = ipahal_parse_stats(IPAHAL_HW_STATS_TETHERING,
-		&ipa3_ctx->hw_stats->teth.init, mem.base, stats_all);
-	if (ret) {
-		IPAERR("failed to parse stats_all (error %d)\n", ret);
-		goto free_stats;
-	}
+/* re-init under snapshot_lock, as in ipa_init_quota_stats() */
+int ipa_init_teth_stats(struct ipa_teth_stats_endpoints *in)
+{
+	int ret;
 
-	/* reset prod_stats cache */
-	for (i = 0; i < IPA_CLIENT_MAX; i++) {
-		memset(&ipa3_ctx->hw_stats->teth.prod_stats[i], 0,
-			sizeof(ipa3_ctx->hw_stats->teth.prod_stats[i]));
-	}
+	if (!(ipa3_ctx->hw_stats && ipa3_ctx->hw_stats->enabled))
+		return 0;
 
-	/*
-	 * update driver cache.
-	 * the stats were read from hardware with clear_after_read meaning
-	 * hardware stats are 0 now
-	 */
-	for (i = 0; i < IPA_CLIENT_MAX; i++) {
-		for (j = 0; j < IPA_CLIENT_MAX; j++) {
-			int prod_idx = ipa3_get_ep_mapping(i);
-			int cons_idx = ipa3_get_ep_mapping(j);
+	mutex_lock(&ipa3_ctx->hw_stats->snapshot_lock);
+	ipa3_ctx->hw_stats->snapshot_valid = false;
+	ret = __ipa_init_teth_stats(in);
+	mutex_unlock(&ipa3_ctx->hw_stats->snapshot_lock);
 
-			if (prod_idx == -1 ||
-				prod_idx >= ipa3_get_max_num_pipes())
-				continue;
+	return ret;
+}
 
-			if (cons_idx == -1 ||
-				cons_idx >= ipa3_get_max_num_pipes())
-				continue;
+int ipa_get_teth_stats(void)
+{
+	struct ipa_hw_stats_teth *sw_stats;
+	int ret;
+	int i;
 
-			prod_reg = ipahal_get_ep_reg_idx(prod_idx);
-			cons_reg = ipahal_get_ep_reg_idx(cons_idx);
+	if (!(ipa3_ctx->hw_stats && ipa3_ctx->hw_stats->enabled &&
+		ipa3_ctx->hw_stats->teth_stats_enabled))
+		return 0;
 
-			/* save hw-query result */
-			if ((init->prod_bitmask[prod_reg] &
-				ipahal_get_ep_bit(prod_idx)) &&
-				(init->cons_bitmask[prod_idx][cons_reg]
-					& ipahal_get_ep_bit(cons_idx))) {
-				IPADBG_LOW("prod %d cons %d\n",
-					prod_idx, cons_idx);
-				stats = &stats_all->stats[prod_idx][cons_idx];
-				IPADBG_LOW("num_ipv4_bytes %lld\n",
-					stats->num_ipv4_bytes);
-				IPADBG_LOW("num_ipv4_pkts %lld\n",
-					stats->num_ipv4_pkts);
-				IPADBG_LOW("num_ipv6_pkts %lld\n",
-					stats->num_ipv6_pkts);
-				IPADBG_LOW("num_ipv6_bytes %lld\n",
-					stats->num_ipv6_bytes);
+	sw_stats = &ipa3_ctx->hw_stats->teth;
 
-				/* update stats*/
-				quota_stats =
-					&sw_stats->prod_stats[i].client[j];
-				quota_stats->num_ipv4_bytes =
-					stats->num_ipv4_bytes;
-				quota_stats->num_ipv4_pkts =
-					stats->num_ipv4_pkts;
-				quota_stats->num_ipv6_bytes =
-					stats->num_ipv6_bytes;
-				quota_stats->num_ipv6_pkts =
-					stats->num_ipv6_pkts;
+	mutex_lock(&ipa3_ctx->hw_stats->snapshot_lock);
+	ret = __ipa_hw_stats_snapshot(false);
+	if (ret)
+		goto unlock;
 
-				/* Accumulated stats */
-				quota_stats =
-					&sw_stats->prod_stats_sum[i].client[j];
-				quota_stats->num_ipv4_bytes +=
-					stats->num_ipv4_bytes;
-				quota_stats->num_ipv4_pkts +=
-					stats->num_ipv4_pkts;
-				quota_stats->num_ipv6_bytes +=
-					stats->num_ipv6_bytes;
-				quota_stats->num_ipv6_pkts +=
-					stats->num_ipv6_pkts;
-			}
+	/* nothing was read since the previous call */
+	if (ipa3_ctx->hw_stats->teth_consumed) {
+		for (i = 0; i < IPA_CLIENT_MAX; i++) {
+			memset(&sw_stats->prod_stats[i], 0,
+				sizeof(sw_stats->prod_stats[i]));
 		}
 	}
-
-	ret = 0;
-free_stats:
-	kfree(stats_all);
-	stats = NULL;
-destroy_imm:
-	for (i = 0; i < num_cmd; i++)
-		ipahal_destroy_imm_cmd(cmd_pyld[i]);
-free_dma_mem:
-	dma_free_coherent(ipa3_ctx->pdev, mem.size, mem.base, mem.phys_base);
+	ipa3_ctx->hw_stats->teth_consumed = true;
+unlock:
+	mutex_unlock(&ipa3_ctx->hw_stats->snapshot_lock);
 	return ret;
-
 }
 
 int ipa_query_teth_stats(enum ipa_client_type prod,
@@ -1293,17 +1500,20 @@ int ipa_reset_teth_stats(enum ipa_client_type prod, enum ipa_client_type cons)
 		return -EINVAL;
 	}
 
+	mutex_lock(&ipa3_ctx->hw_stats->snapshot_lock);
 	/* reading stats will reset them in hardware */
-	ret = ipa_get_teth_stats();
+	ret = __ipa_hw_stats_snapshot(true);
 	if (ret) {
-		IPAERR("ipa_get_teth_stats failed %d\n", ret);
-		return ret;
+		IPAERR("ipa_hw_stats_snapshot failed %d\n", ret);
+		goto unlock;
 	}
 
 	/* reset driver's cache */
 	stats = &ipa3_ctx->hw_stats->teth.prod_stats_sum[prod].client[cons];
 	memset(stats, 0, sizeof(*stats));
-	return 0;
+unlock:
+	mutex_unlock(&ipa3_ctx->hw_stats->snapshot_lock);
+	return ret;
 }
 
 int ipa_reset_all_cons_teth_stats(enum ipa_client_type prod)
@@ -1321,11 +1531,12 @@ int ipa_reset_all_cons_teth_stats(enum ipa_client_type prod)
 		return -EINVAL;
 	}
 
+	mutex_lock(&ipa3_ctx->hw_stats->snapshot_lock);
 	/* reading stats will reset them in hardware */
-	ret = ipa_get_teth_stats();
+	ret = __ipa_hw_stats_snapshot(true);
 	if (ret) {
-		IPAERR("ipa_get_teth_stats failed %d\n", ret);
-		return ret;
+		IPAERR("ipa_hw_stats_snapshot failed %d\n", ret);
+		goto unlock;
 	}
 
 	/* reset driver's cache */
@@ -1333,8 +1544,9 @@ int ipa_reset_all_cons_teth_stats(enum ipa_client_type prod)
 		stats = &ipa3_ctx->hw_stats->teth.prod_stats_sum[prod].client[i];
 		memset(stats, 0, sizeof(*stats));
 	}
-
-	return 0;
+unlock:
+	mutex_unlock(&ipa3_ctx->hw_stats->snapshot_lock);
+	return ret;
 }
 
 int ipa_reset_all_teth_stats(void)
@@ -1347,17 +1559,12 @@ int ipa_reset_all_teth_stats(void)
 		ipa3_ctx->hw_stats->teth_stats_enabled))
 		return 0;
 
+	mutex_lock(&ipa3_ctx->hw_stats->snapshot_lock);
 	/* reading stats will reset them in hardware */
-	for (i = 0; i < IPA_CLIENT_MAX; i++) {
-		if (IPA_CLIENT_IS_PROD(i) && ipa3_get_ep_mapping(i) != -1) {
-			ret = ipa_get_teth_stats();
-			if (ret) {
-				IPAERR("ipa_get_teth_stats failed %d\n", ret);
-				return ret;
-			}
-			/* a single iteration will reset all hardware stats */
-			break;
-		}
+	ret = __ipa_hw_stats_snapshot(true);
+	if (ret) {
+		IPAERR("ipa_hw_stats_snapshot failed %d\n", ret);
+		goto unlock;
 	}
 
 	/* reset driver's cache */
@@ -1365,8 +1572,9 @@ int ipa_reset_all_teth_stats(void)
 		stats = &ipa3_ctx->hw_stats->teth.prod_stats_sum[i];
 		memset(stats, 0, sizeof(*stats));
 	}
-
-	return 0;
+unlock:
+	mutex_unlock(&ipa3_ctx->hw_stats->snapshot_lock);
+	return ret;
 }
 
 int ipa_init_flt_rt_stats(void)
@@ -1884,7 +2092,7 @@ int ipa_drop_stats_init(void)
 	return ipa_init_drop_stats(pipe_bitmask);
 }
 
-int ipa_init_drop_stats(u32 *pipe_bitmask)
+static int __ipa_init_drop_stats(u32 *pipe_bitmask)
 {
 	struct ipahal_stats_init_pyld *pyld;
 	struct ipahal_imm_cmd_dma_shared_mem cmd = { 0 };
@@ -2084,137 +2292,37 @@ fail_free_desc:
 	return ret;
 }
 
-int ipa_get_drop_stats(struct ipa_drop_stats_all *out)
+/* re-init under snapshot_lock, as in ipa_init_quota_stats() */
+int ipa_init_drop_stats(u32 *pipe_bitmask)
 {
-	int i;
 	int ret;
-	struct ipahal_stats_get_offset_drop get_offset = { { 0 } };
-	struct ipahal_stats_offset offset = { 0 };
-	struct ipahal_imm_cmd_dma_shared_mem cmd = { 0 };
-	struct ipahal_imm_cmd_pyld *cmd_pyld[2];
-	struct ipa_mem_buffer mem;
-	struct ipa3_desc desc[2];
-	struct ipahal_stats_drop_all *stats;
-	int num_cmd = 0;
 
 	if (!(ipa3_ctx->hw_stats && ipa3_ctx->hw_stats->enabled))
 		return 0;
 
-	memset(desc, 0, sizeof(desc));
-	memset(cmd_pyld, 0, sizeof(cmd_pyld));
+	mutex_lock(&ipa3_ctx->hw_stats->snapshot_lock);
+	ipa3_ctx->hw_stats->snapshot_valid = false;
+	ret = __ipa_init_drop_stats(pipe_bitmask);
+	mutex_unlock(&ipa3_ctx->hw_stats->snapshot_lock);
 
-	get_offset.init = ipa3_ctx->hw_stats->drop.init;
-	ret = ipahal_stats_get_offset(IPAHAL_HW_STATS_DROP, &get_offset,
-		&offset);
-	if (ret) {
-		IPAERR("failed to get offset from hal %d\n", ret);
-		return ret;
-	}
+	return ret;
+}
 
-	IPADBG_LOW("offset = %d size = %d\n", offset.offset, offset.size);
+int ipa_get_drop_stats(struct ipa_drop_stats_all *out)
+{
+	int ret;
 
-	if (offset.size == 0)
+	if (!(ipa3_ctx->hw_stats && ipa3_ctx->hw_stats->enabled))
 		return 0;
 
-	mem.size = offset.size;
-	mem.base = dma_alloc_coherent(ipa3_ctx->pdev,
-		mem.size,
-		&mem.phys_base,
-		GFP_KERNEL);
-	if (!mem.base) {
-		IPAERR("fail to alloc DMA memory\n");
-		return ret;
-	}
-
-	/* IC to close the coal frame before HPS Clear if coal is enabled */
-	if (ipa3_get_ep_mapping(IPA_CLIENT_APPS_WAN_COAL_CONS) !=
-		IPA_EP_NOT_ALLOCATED && !ipa3_ctx->ulso_wa) {
-		ipa_close_coal_frame(&cmd_pyld[num_cmd]);
-		if (!cmd_pyld[num_cmd]) {
-			IPAERR("failed to construct coal close IC\n");
-			ret = -ENOMEM;
-			goto free_dma_mem;
-		}
-		ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
-		++num_cmd;
-	}
-
-	cmd.is_read = true;
-	cmd.clear_after_read = true;
-	cmd.skip_pipeline_clear = false;
-	cmd.pipeline_clear_options = IPAHAL_HPS_CLEAR;
-	cmd.size = mem.size;
-	cmd.system_addr = mem.phys_base;
-	cmd.local_addr = ipa3_ctx->smem_restricted_bytes +
-		IPA_MEM_PART(stats_drop_ofst) + offset.offset;
-	cmd_pyld[num_cmd] = ipahal_construct_imm_cmd(
-		IPA_IMM_CMD_DMA_SHARED_MEM, &cmd, false);
-	if (!cmd_pyld[num_cmd]) {
-		IPAERR("failed to construct dma_shared_mem imm cmd\n");
-		ret = -ENOMEM;
-		goto destroy_imm;
-	}
-	ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
-	++num_cmd;
-
-	ret = ipa3_send_cmd(num_cmd, desc);
-	if (ret) {
-		IPAERR("failed to send immediate command (error %d)\n", ret);
-		goto destroy_imm;
-	}
-
-	stats = kzalloc(sizeof(*stats), GFP_KERNEL);
-	if (!stats) {
-		ret = -ENOMEM;
-		goto destroy_imm;
-	}
-
-	ret = ipahal_parse_stats(IPAHAL_HW_STATS_DROP,
-		&ipa3_ctx->hw_stats->drop.init, mem.base, stats);
-	if (ret) {
-		IPAERR("failed to parse stats (error %d)\n", ret);
-		goto free_stats;
-	}
-
-	/*
-	 * update driver cache.
-	 * the stats were read from hardware with clear_after_read meaning
-	 * hardware stats are 0 now
-	 */
-	for (i = 0; i < IPA_CLIENT_MAX; i++) {
-		int ep_idx = ipa3_get_ep_mapping(i);
-
-		if (ep_idx == -1 || ep_idx >= ipa3_get_max_num_pipes())
-			continue;
-
-		if (ipa3_ctx->ep[ep_idx].client != i)
-			continue;
-
-		ipa3_ctx->hw_stats->drop.stats.client[i].drop_byte_cnt +=
-			stats->stats[ep_idx].drop_byte_cnt;
-		ipa3_ctx->hw_stats->drop.stats.client[i].drop_packet_cnt +=
-			stats->stats[ep_idx].drop_packet_cnt;
-	}
-
-
-	if (!out) {
-		ret = 0;
-		goto free_stats;
-	}
-
+	mutex_lock(&ipa3_ctx->hw_stats->snapshot_lock);
+	ret = __ipa_hw_stats_snapshot(false);
 	/* copy results to out parameter */
-	*out = ipa3_ctx->hw_stats->drop.stats;
+	if (!ret && out)
+		*out = ipa3_ctx->hw_stats->drop.stats;
+	mutex_unlock(&ipa3_ctx->hw_stats->snapshot_lock);
 
-	ret = 0;
-free_stats:
-	kfree(stats);
-destroy_imm:
-	for (i = 0; i < num_cmd; i++)
-		ipahal_destroy_imm_cmd(cmd_pyld[i]);
-free_dma_mem:
-	dma_free_coherent(ipa3_ctx->pdev, mem.size, mem.base, mem.phys_base);
 	return ret;
-
 }
 
 int ipa_reset_drop_stats(enum ipa_client_type client)
@@ -2230,17 +2338,20 @@ int ipa_reset_drop_stats(enum ipa_client_type client)
 		return -EINVAL;
 	}
 
+	mutex_lock(&ipa3_ctx->hw_stats->snapshot_lock);
 	/* reading stats will reset them in hardware */
-	ret = ipa_get_drop_stats(NULL);
+	ret = __ipa_hw_stats_snapshot(true);
 	if (ret) {
-		IPAERR("ipa_get_drop_stats failed %d\n", ret);
-		return ret;
+		IPAERR("ipa_hw_stats_snapshot failed %d\n", ret);
+		goto unlock;
 	}
 
 	/* reset driver's cache */
 	stats = &ipa3_ctx->hw_stats->drop.stats.client[client];
 	memset(stats, 0, sizeof(*stats));
-	return 0;
+unlock:
+	mutex_unlock(&ipa3_ctx->hw_stats->snapshot_lock);
+	return ret;
 }
 
 int ipa_reset_all_drop_stats(void)
@@ -2251,17 +2362,20 @@ int ipa_reset_all_drop_stats(void)
 	if (!(ipa3_ctx->hw_stats && ipa3_ctx->hw_stats->enabled))
 		return 0;
 
+	mutex_lock(&ipa3_ctx->hw_stats->snapshot_lock);
 	/* reading stats will reset them in hardware */
-	ret = ipa_get_drop_stats(NULL);
+	ret = __ipa_hw_stats_snapshot(true);
 	if (ret) {
-		IPAERR("ipa_get_drop_stats failed %d\n", ret);
-		return ret;
+		IPAERR("ipa_hw_stats_snapshot failed %d\n", ret);
+		goto unlock;
 	}
 
 	/* reset driver's cache */
 	stats = &ipa3_ctx->hw_stats->drop.stats;
 	memset(stats, 0, sizeof(*stats));
-	return 0;
+unlock:
+	mutex_unlock(&ipa3_ctx->hw_stats->snapshot_lock);
+	return ret;
 }
 
 
@@ -2793,6 +2907,41 @@ bail:
 	return ret;
 }
 
+static ssize_t ipa_debugfs_set_snapshot_interval(struct file *file,
+	const char __user *ubuf, size_t count, loff_t *ppos)
+{
+	u32 interval_ms;
+	int ret;
+
+	ret = kstrtou32_from_user(ubuf, count, 0, &interval_ms);
+	if (ret)
+		return ret;
+
+	mutex_lock(&ipa3_ctx->hw_stats->snapshot_lock);
+	ipa3_ctx->hw_stats->snapshot_interval_ms = interval_ms;
+	ipa3_ctx->hw_stats->snapshot_valid = false;
+	mutex_unlock(&ipa3_ctx->hw_stats->snapshot_lock);
+
+	return count;
+}
+
+static ssize_t ipa_debugfs_print_snapshot(struct file *file,
+	char __user *ubuf, size_t count, loff_t *ppos)
+{
+	int nbytes;
+
+	mutex_lock(&ipa3_ctx->lock);
+	nbytes = scnprintf(dbg_buff, IPA_MAX_MSG_LEN,
+		"interval_ms=%u snapshots=%llu cached=%llu\n",
+		ipa3_ctx->hw_stats->snapshot_interval_ms,
+		ipa3_ctx->hw_stats->snapshot_cnt,
+		ipa3_ctx->hw_stats->snapshot_cached_cnt);
+	nbytes = simple_read_from_buffer(ubuf, count, ppos, dbg_buff, nbytes);
+	mutex_unlock(&ipa3_ctx->lock);
+
+	return nbytes;
+}
+
 static const struct file_operations ipa3_quota_ops = {
 	.read = ipa_debugfs_print_quota_stats,
 	.write = ipa_debugfs_reset_quota_stats,
@@ -2817,6 +2966,11 @@ static const struct file_operations ipa3_enable_drop_ops = {
 	.write = ipa_debugfs_enable_disable_drop_stats,
 };
 
+static const struct file_operations ipa3_snapshot_ops = {
+	.read = ipa_debugfs_print_snapshot,
+	.write = ipa_debugfs_set_snapshot_interval,
+};
+
 int ipa_debugfs_init_stats(struct dentry *parent)
 {
 	const mode_t read_write_mode = 0664;
@@ -2868,6 +3022,13 @@ int ipa_debugfs_init_stats(struct dentry *parent)
 		goto fail;
 	}
 
+	file = debugfs_create_file("snapshot", read_write_mode, dent, NULL,
+		&ipa3_snapshot_ops);
+	if (IS_ERR_OR_NULL(file)) {
+		IPAERR("fail to create file %s\n", "snapshot");
+		goto fail;
+	}
+
 	return 0;
 fail:
 	debugfs_remove_recursive(dent);
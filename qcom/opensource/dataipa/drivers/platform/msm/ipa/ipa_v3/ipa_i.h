@@ -13,6 +13,7 @@
 #include <linux/export.h>
 #include <linux/idr.h>
 #include <linux/list.h>
+#include <linux/llist.h>
 #include <linux/mutex.h>
 #include <linux/skbuff.h>
 #include <linux/slab.h>
@@ -119,6 +120,9 @@ enum {
 
 #define IPA_MAX_STATUS_STAT_NUM 30
 
+/* Max descriptors ipa3_send() accepts in one chain */
+#define IPA_SEND_MAX_DESC (20)
+
 #define IPA_IPC_LOG_PAGES 50
 
 #define IPA_MAX_NUM_REQ_CACHE 10
@@ -963,6 +967,39 @@ struct ipa3_flt_tbl_nhash_lcl {
 	struct ipa3_flt_tbl *tbl;
 };
 
+/**
+ * struct ipa3_fltrt_shadow_buf - copy of one image region written to SRAM
+ * @base: copy of the image
+ * @size: allocated size of the copy
+ */
+struct ipa3_fltrt_shadow_buf {
+	u8 *base;
+	u32 size;
+};
+
+/**
+ * struct ipa3_fltrt_shadow - last FLT/RT images committed to SRAM by apps
+ *  Used to skip DMA of header entries and local bodies that are unchanged
+ * @valid: the copies below match SRAM contents
+ * @cmp: copies may be compared against during the ongoing commit
+ * @lost: a region could not be recorded during the ongoing commit
+ * @hdr: table header images, per rule type
+ * @bdy: local table body images, per rule type
+ * @commits: number of commits
+ * @dma_skipped: number of DMA commands skipped as unchanged
+ * @dma_sent: number of DMA commands sent
+ */
+struct ipa3_fltrt_shadow {
+	bool valid;
+	bool cmp;
+	bool lost;
+	struct ipa3_fltrt_shadow_buf hdr[IPA_RULE_TYPE_MAX];
+	struct ipa3_fltrt_shadow_buf bdy[IPA_RULE_TYPE_MAX];
+	u64 commits;
+	u64 dma_skipped;
+	u64 dma_sent;
+};
+
 /**
  * struct ipa3_rt_entry - IPA routing table entry
  * @link: entry's link in global routing table entries list
@@ -1579,6 +1616,9 @@ struct ipa3_page_recycle_stats {
 	u64 total_replenished;
 	u64 page_recycled;
 	u64 tmp_alloc;
+	u64 bulk_refill;
+	u64 bulk_miss;
+	u64 scan_len;
 };
 
 struct ipa3_stats {
@@ -1955,6 +1995,18 @@ struct ipa_hw_stats {
 	struct ipa_hw_stats_flt_rt flt_rt;
 	struct ipa_hw_stats_drop drop;
 	bool teth_stats_enabled;
+	/*
+	 * quota/teth/drop caches are refreshed together from one SRAM read,
+	 * which is reused for snapshot_interval_ms (0: always read)
+	 */
+	struct mutex snapshot_lock;
+	unsigned long snapshot_time;
+	u32 snapshot_interval_ms;
+	bool snapshot_valid;
+	/* prod_stats was handed to ipa_get_teth_stats() callers */
+	bool teth_consumed;
+	u64 snapshot_cnt;
+	u64 snapshot_cached_cnt;
 };
 
 struct ipa_cne_evt {
@@ -2345,6 +2397,8 @@ struct ipa3_context {
 	bool flt_tbl_hash_lcl[IPA_IP_MAX];
 	bool flt_tbl_nhash_lcl[IPA_IP_MAX];
 	struct list_head flt_tbl_nhash_lcl_list[IPA_IP_MAX];
+	struct ipa3_fltrt_shadow flt_shadow[IPA_IP_MAX];
+	struct ipa3_fltrt_shadow rt_shadow[IPA_IP_MAX];
 	struct ipa3_active_clients ipa3_active_clients;
 	struct ipa3_active_clients_log_ctx ipa3_active_clients_logging;
 	struct workqueue_struct *power_mgmt_wq;
@@ -2359,6 +2413,7 @@ struct ipa3_context {
 	spinlock_t disconnect_lock;
 	u8 a5_pipe_index;
 	struct list_head intf_list;
+	struct llist_head msg_llist;
 	struct list_head msg_list;
 	struct list_head pull_msg_list;
 	struct mutex msg_lock;
@@ -3390,6 +3445,14 @@ int _ipa_init_flt6_v3(void);
 
 int __ipa_commit_flt_v3(enum ipa_ip_type ip);
 int __ipa_commit_rt_v3(enum ipa_ip_type ip);
+void ipa3_fltrt_shadow_begin(struct ipa3_fltrt_shadow *sh);
+bool ipa3_fltrt_shadow_changed(struct ipa3_fltrt_shadow *sh,
+	struct ipa3_fltrt_shadow_buf *buf, u32 ofst, const void *img, u32 len);
+void ipa3_fltrt_shadow_end(struct ipa3_fltrt_shadow *sh);
+void ipa3_fltrt_shadow_invalidate(void);
+void ipa3_fltrt_shadow_free(void);
+bool ipa3_fltrt_sys_tbl_unchanged(struct ipa_mem_buffer *curr,
+	struct ipa_mem_buffer *mem);
 
 int __ipa_commit_hdr_v3_0(void);
 void ipa3_skb_recycle(struct sk_buff *skb);
@@ -3514,6 +3577,8 @@ int ipa_init_teth_stats(struct ipa_teth_stats_endpoints *in);
 
 int ipa_get_teth_stats(void);
 
+int ipa_hw_stats_snapshot(bool force);
+
 int ipa_query_teth_stats(enum ipa_client_type prod,
 	struct ipa_quota_stats_all *out, bool reset);
 
@@ -27,6 +27,8 @@ struct ipa3_push_msg {
 	ipa_msg_free_fn callback;
 	void *buff;
 	struct list_head link;
+	struct llist_node llnode;
+	u8 data[];
 };
 
 struct ipa3_pull_msg {
@@ -382,6 +384,43 @@ static void ipa3_send_msg_free(void *buff, u32 len, u32 type)
 	kfree(buff);
 }
 
+/* payload lives in the same allocation as the message */
+static void ipa3_send_msg_inline_free(void *buff, u32 len, u32 type)
+{
+}
+
+static struct ipa3_push_msg *ipa3_push_msg_alloc(struct ipa_msg_meta *meta,
+	void *buff)
+{
+	struct ipa3_push_msg *msg;
+	u32 len = buff ? meta->msg_len : 0;
+
+	msg = kmalloc(sizeof(*msg) + len, GFP_KERNEL);
+	if (msg == NULL)
+		return NULL;
+
+	memset(msg, 0, sizeof(*msg));
+	msg->meta = *meta;
+	if (len) {
+		memcpy(msg->data, buff, len);
+		msg->buff = msg->data;
+		msg->callback = ipa3_send_msg_inline_free;
+	}
+
+	return msg;
+}
+
+/*
+ * Producers only push to the lock-less list, ipa3_read() moves the whole
+ * batch over to msg_list under msg_lock.
+ */
+static void ipa3_queue_msg(struct ipa3_push_msg *msg)
+{
+	llist_add(&msg->llnode, &ipa3_ctx->msg_llist);
+	wake_up(&ipa3_ctx->msg_waitq);
+}
+
+/* msg_wlan_client_lock must be held */
 static int wlan_msg_process(struct ipa_msg_meta *meta, void *buff)
 {
 	struct ipa3_push_msg *msg_dup;
@@ -417,18 +456,14 @@ static int wlan_msg_process(struct ipa_msg_meta *meta, void *buff)
 			}
 		}
 
-		mutex_lock(&ipa3_ctx->msg_wlan_client_lock);
 		msg_dup = kzalloc(sizeof(*msg_dup), GFP_KERNEL);
-		if (msg_dup == NULL) {
-			mutex_unlock(&ipa3_ctx->msg_wlan_client_lock);
+		if (msg_dup == NULL)
 			return -ENOMEM;
-		}
 		msg_dup->meta = *meta;
 		if (meta->msg_len > 0 && buff) {
 			data_dup = kmemdup(buff, meta->msg_len, GFP_KERNEL);
 			if (data_dup == NULL) {
 				kfree(msg_dup);
-				mutex_unlock(&ipa3_ctx->msg_wlan_client_lock);
 				return -ENOMEM;
 			}
 			memcpy(data_dup, buff, meta->msg_len);
@@ -437,11 +472,9 @@ static int wlan_msg_process(struct ipa_msg_meta *meta, void *buff)
 		} else {
 			IPAERR("msg_len %d\n", meta->msg_len);
 			kfree(msg_dup);
-			mutex_unlock(&ipa3_ctx->msg_wlan_client_lock);
 			return -ENOMEM;
 		}
 		list_add_tail(&msg_dup->link, &ipa3_ctx->msg_wlan_client_list);
-		mutex_unlock(&ipa3_ctx->msg_wlan_client_lock);
 	}
 
 	/* remove the cache */
@@ -455,7 +488,6 @@ static int wlan_msg_process(struct ipa_msg_meta *meta, void *buff)
 			event_ex_cur_discon->mac_addr,
 			sizeof(mac2));
 
-		mutex_lock(&ipa3_ctx->msg_wlan_client_lock);
 		list_for_each_entry_safe(entry, next,
 				&ipa3_ctx->msg_wlan_client_list,
 				link) {
@@ -481,11 +513,11 @@ static int wlan_msg_process(struct ipa_msg_meta *meta, void *buff)
 			}
 			total++;
 		}
-		mutex_unlock(&ipa3_ctx->msg_wlan_client_lock);
 	}
 	return 0;
 }
 
+/* msg_lan_lock must be held */
 static int lan_msg_process(struct ipa_msg_meta *meta, void *buff)
 {
 	struct ipa3_push_msg *msg_dup = NULL;
@@ -506,20 +538,16 @@ static int lan_msg_process(struct ipa_msg_meta *meta, void *buff)
 		IPADBG("ifindex: %d\n", ecm_msg_con->ifindex);
 		IPADBG("interface name: %s\n", ecm_msg_con->name);
 
-		mutex_lock(&ipa3_ctx->msg_lan_lock);
 		if (meta->msg_len > 0 && buff) {
 
 			msg_dup = kzalloc(sizeof(*msg_dup), GFP_KERNEL);
-			if (msg_dup == NULL) {
-				mutex_unlock(&ipa3_ctx->msg_lan_lock);
+			if (msg_dup == NULL)
 				return -ENOMEM;
-			}
 
 			msg_dup->meta = *meta;
 			data_dup = kmalloc(meta->msg_len, GFP_KERNEL);
 			if (data_dup == NULL) {
 				kfree(msg_dup);
-				mutex_unlock(&ipa3_ctx->msg_lan_lock);
 				return -ENOMEM;
 			}
 			memcpy(data_dup, buff, meta->msg_len);
@@ -527,11 +555,9 @@ static int lan_msg_process(struct ipa_msg_meta *meta, void *buff)
 			msg_dup->callback = ipa3_send_msg_free;
 		} else {
 			IPAERR("msg_len %d\n", meta->msg_len);
-			mutex_unlock(&ipa3_ctx->msg_lan_lock);
 			return -EINVAL;
 		}
 		list_add_tail(&msg_dup->link, &ipa3_ctx->msg_lan_list);
-		mutex_unlock(&ipa3_ctx->msg_lan_lock);
 	}
 
 	/* remove the cache */
@@ -543,7 +569,6 @@ static int lan_msg_process(struct ipa_msg_meta *meta, void *buff)
 		IPADBG("ifindex: %d\n", ecm_msg_discon->ifindex);
 		IPADBG("interface name: %s\n", ecm_msg_discon->name);
 
-		mutex_lock(&ipa3_ctx->msg_lan_lock);
 		list_for_each_entry_safe(entry, next,
 			&ipa3_ctx->msg_lan_list, link) {
 			ecm_event_list = entry->buff;
@@ -556,14 +581,24 @@ static int lan_msg_process(struct ipa_msg_meta *meta, void *buff)
 				kfree(entry);
 			}
 		}
-
-		mutex_unlock(&ipa3_ctx->msg_lan_lock);
-
 	}
 
 	return 0;
 }
 
+/* cache lock a message type is queued under, NULL if it is not cached */
+static struct mutex *ipa3_msg_cache_lock(u32 msg_type)
+{
+	if (WLAN_IPA_CONNECT_EVENT(msg_type) ||
+		WLAN_IPA_DISCONNECT_EVENT(msg_type))
+		return &ipa3_ctx->msg_wlan_client_lock;
+
+	if (msg_type == ECM_CONNECT || msg_type == ECM_DISCONNECT)
+		return &ipa3_ctx->msg_lan_lock;
+
+	return NULL;
+}
+
 /**
  * ipa3_send_msg() - Send "message" from kernel client to IPA driver
  * @meta: [in] message meta-data
@@ -583,7 +618,7 @@ int ipa3_send_msg(struct ipa_msg_meta *meta, void *buff,
 		  ipa_msg_free_fn callback)
 {
 	struct ipa3_push_msg *msg;
-	void *data = NULL;
+	struct mutex *cache_lock;
 
 	if (meta == NULL || (buff == NULL && callback != NULL) ||
 	    (buff != NULL && callback == NULL)) {
@@ -597,63 +632,47 @@ int ipa3_send_msg(struct ipa_msg_meta *meta, void *buff,
 		return -EINVAL;
 	}
 
-	msg = kzalloc(sizeof(struct ipa3_push_msg), GFP_KERNEL);
+	msg = ipa3_push_msg_alloc(meta, buff);
 	if (msg == NULL)
 		return -ENOMEM;
 
-	msg->meta = *meta;
-	if (meta->msg_len > 0 && buff) {
-		data = kmemdup(buff, meta->msg_len, GFP_KERNEL);
-		if (data == NULL) {
-			kfree(msg);
-			return -ENOMEM;
-		}
-		msg->buff = data;
-		msg->callback = ipa3_send_msg_free;
-	}
+	/*
+	 * support for softap client event cache. A cached event type is
+	 * queued under its cache lock, so a resend can not replay a cache
+	 * entry out of order with the event that updates it.
+	 */
+	cache_lock = ipa3_msg_cache_lock(meta->msg_type);
+	if (cache_lock)
+		mutex_lock(cache_lock);
 
-	mutex_lock(&ipa3_ctx->msg_lock);
-	list_add_tail(&msg->link, &ipa3_ctx->msg_list);
-	/* support for softap client event cache */
 	if (wlan_msg_process(meta, buff))
 		IPAERR_RL("wlan_msg_process failed\n");
 
 	if (lan_msg_process(meta, buff))
 		IPAERR_RL("lan_msg_process failed\n");
 
-	/* unlock only after process */
-	mutex_unlock(&ipa3_ctx->msg_lock);
+	ipa3_queue_msg(msg);
+
+	if (cache_lock)
+		mutex_unlock(cache_lock);
+
 	IPA_STATS_INC_CNT(ipa3_ctx->stats.msg_w[meta->msg_type]);
 
-	wake_up(&ipa3_ctx->msg_waitq);
 	if (buff)
 		callback(buff, meta->msg_len, meta->msg_type);
 
 	return 0;
 }
 
-/**
- * ipa3_resend_wlan_msg() - Resend cached "message" to IPACM
- *
- * resend wlan client connect/AP_CONNECT/STA_CONNECT events to 
- * user-space
- *
- * Returns:	0 on success, negative on failure
- *
- * Note:	Should not be called from atomic context
- */
-int ipa3_resend_wlan_msg(void)
+/* replay the wlan client cache, msg_wlan_client_lock must be held */
+static int __ipa3_resend_wlan_msg(void)
 {
 	struct ipa_wlan_msg_ex *event_ex_list = NULL;
 	struct ipa3_push_msg *entry;
 	struct ipa3_push_msg *next;
 	int cnt = 0, total = 0;
 	struct ipa3_push_msg *msg;
-	void *data = NULL;
-
-	IPADBG("\n");
 
-	mutex_lock(&ipa3_ctx->msg_wlan_client_lock);
 	list_for_each_entry_safe(entry, next, &ipa3_ctx->msg_wlan_client_list,
 			link) {
 
@@ -666,82 +685,83 @@ int ipa3_resend_wlan_msg(void)
 			}
 		}
 
-		msg = kzalloc(sizeof(*msg), GFP_KERNEL);
-		if (msg == NULL) {
-			mutex_unlock(&ipa3_ctx->msg_wlan_client_lock);
+		msg = ipa3_push_msg_alloc(&entry->meta, entry->buff);
+		if (msg == NULL)
 			return -ENOMEM;
-		}
-		msg->meta = entry->meta;
-		data = kmemdup(entry->buff, entry->meta.msg_len, GFP_KERNEL);
-		if (data == NULL) {
-			kfree(msg);
-			mutex_unlock(&ipa3_ctx->msg_wlan_client_lock);
-			return -ENOMEM;
-		}
-		msg->buff = data;
-		msg->callback = ipa3_send_msg_free;
-		mutex_lock(&ipa3_ctx->msg_lock);
-		list_add_tail(&msg->link, &ipa3_ctx->msg_list);
-		mutex_unlock(&ipa3_ctx->msg_lock);
-		wake_up(&ipa3_ctx->msg_waitq);
+		ipa3_queue_msg(msg);
 
 		total++;
 	}
-	mutex_unlock(&ipa3_ctx->msg_wlan_client_lock);
 	return 0;
 }
 
 /**
- * ipa3_resend_lan_msg() - Resend cached "message" to IPACM
+ * ipa3_resend_wlan_msg() - Resend cached "message" to IPACM
  *
- * resend ecm connect/disconnect events to user-space
+ * resend wlan client connect/AP_CONNECT/STA_CONNECT events to 
+ * user-space
  *
- * Returns:     0 on success, negative on failure
+ * Returns:	0 on success, negative on failure
  *
- * Note:        Should not be called from atomic context
+ * Note:	Should not be called from atomic context
  */
+int ipa3_resend_wlan_msg(void)
+{
+	int retval;
 
-int ipa3_resend_lan_msg(void)
+	IPADBG("\n");
+
+	mutex_lock(&ipa3_ctx->msg_wlan_client_lock);
+	retval = __ipa3_resend_wlan_msg();
+	mutex_unlock(&ipa3_ctx->msg_wlan_client_lock);
+	return retval;
+}
+
+/* replay the ecm cache, msg_lan_lock must be held */
+static int __ipa3_resend_lan_msg(void)
 {
 	struct ipa3_push_msg *entry = NULL;
 	struct ipa3_push_msg *next = NULL;
 	struct ipa_ecm_msg *ecm_msg = NULL;
 	struct ipa3_push_msg *msg = NULL;
-	void *data = NULL;
 
-	IPADBG("\n");
-	mutex_lock(&ipa3_ctx->msg_lan_lock);
 	list_for_each_entry_safe(entry, next, &ipa3_ctx->msg_lan_list, link) {
 		ecm_msg = entry->buff;
 
 		IPADBG("ifindex: %d\n", ecm_msg->ifindex);
 		IPADBG("interface name: %s\n", ecm_msg->name);
 
-		msg = kzalloc(sizeof(*msg), GFP_KERNEL);
-		if (msg == NULL) {
-			mutex_unlock(&ipa3_ctx->msg_lan_lock);
-			return -ENOMEM;
-		}
-		msg->meta = entry->meta;
-		data = kzalloc(entry->meta.msg_len, GFP_KERNEL);
-		if (data == NULL) {
-			kfree(msg);
-			mutex_unlock(&ipa3_ctx->msg_lan_lock);
+		msg = ipa3_push_msg_alloc(&entry->meta, entry->buff);
+		if (msg == NULL)
 			return -ENOMEM;
-		}
-		memcpy(data, entry->buff, entry->meta.msg_len);
-		msg->buff = data;
-		msg->callback = ipa3_send_msg_free;
-		mutex_lock(&ipa3_ctx->msg_lock);
-		list_add_tail(&msg->link, &ipa3_ctx->msg_list);
-		mutex_unlock(&ipa3_ctx->msg_lock);
-		wake_up(&ipa3_ctx->msg_waitq);
+		ipa3_queue_msg(msg);
 	}
-	mutex_unlock(&ipa3_ctx->msg_lan_lock);
 
 	return 0;
 }
 
+/**
+ * ipa3_resend_lan_msg() - Resend cached "message" to IPACM
+ *
+ * resend ecm connect/disconnect events to user-space
+ *
+ * Returns:     0 on success, negative on failure
+ *
+ * Note:        Should not be called from atomic context
+ */
+
+int ipa3_resend_lan_msg(void)
+{
+	int retval;
+
+	IPADBG("\n");
+	mutex_lock(&ipa3_ctx->msg_lan_lock);
+	retval = __ipa3_resend_lan_msg();
+	mutex_unlock(&ipa3_ctx->msg_lan_lock);
+
+	return retval;
+}
+
 /*
  * ipa3_send_done_restore_msg() - Resend done_restore_msg to IPACM
  *
@@ -764,10 +784,7 @@ static int ipa3_send_done_restore_msg(void)
 	msg->buff = NULL;
 	msg->callback = ipa3_send_msg_free;
 
-	mutex_lock(&ipa3_ctx->msg_lock);
-	list_add_tail(&msg->link, &ipa3_ctx->msg_list);
-	mutex_unlock(&ipa3_ctx->msg_lock);
-	wake_up(&ipa3_ctx->msg_waitq);
+	ipa3_queue_msg(msg);
 
 	return 0;
 }
@@ -775,6 +792,9 @@ static int ipa3_send_done_restore_msg(void)
 /*
  * ipa3_resend_driver_msg() - Resend done_restore_msg to IPACM
  *
+ * Both caches stay locked until IPA_DONE_RESTORE_EVENT is queued, so no
+ * client event can land in the middle of the replay.
+ *
  * Returns:     0 on success, negative on failure
  *
  */
@@ -782,13 +802,17 @@ static int ipa3_send_done_restore_msg(void)
 int ipa3_resend_driver_msg(void)
 {
 	int retval = 0;
+
+	mutex_lock(&ipa3_ctx->msg_wlan_client_lock);
+	mutex_lock(&ipa3_ctx->msg_lan_lock);
+
 	IPADBG("resend wlan msg\n");
-	retval = ipa3_resend_wlan_msg();
+	retval = __ipa3_resend_wlan_msg();
 	if (retval)
 		goto fail;
 
 	IPADBG("resend lan msg\n");
-	retval = ipa3_resend_lan_msg();
+	retval = __ipa3_resend_lan_msg();
 	if (retval)
 		goto fail;
 
@@ -796,6 +820,8 @@ int ipa3_resend_driver_msg(void)
 	retval = ipa3_send_done_restore_msg();
 
 fail:
+	mutex_unlock(&ipa3_ctx->msg_lan_lock);
+	mutex_unlock(&ipa3_ctx->msg_wlan_client_lock);
 	return retval;
 }
 
@@ -870,6 +896,21 @@ int ipa3_deregister_pull_msg(struct ipa_msg_meta *meta)
 	return result;
 }
 
+/* Move all pushed messages to msg_list in order, msg_lock must be held */
+static void ipa3_splice_msgs(void)
+{
+	struct ipa3_push_msg *msg, *tmp;
+	struct llist_node *first;
+
+	first = llist_del_all(&ipa3_ctx->msg_llist);
+	if (!first)
+		return;
+
+	first = llist_reverse_order(first);
+	llist_for_each_entry_safe(msg, tmp, first, llnode)
+		list_add_tail(&msg->link, &ipa3_ctx->msg_list);
+}
+
 /**
  * ipa3_read() - read message from IPA device
  * @filp:	[in] file pointer
@@ -903,6 +944,9 @@ ssize_t ipa3_read(struct file *filp, char __user *buf, size_t count,
 		mutex_lock(&ipa3_ctx->msg_lock);
 		locked = 1;
 
+		if (list_empty(&ipa3_ctx->msg_list))
+			ipa3_splice_msgs();
+
 		if (!list_empty(&ipa3_ctx->msg_list)) {
 			msg = list_first_entry(&ipa3_ctx->msg_list,
 					struct ipa3_push_msg, link);
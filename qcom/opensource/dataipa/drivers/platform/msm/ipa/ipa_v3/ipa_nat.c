@@ -38,7 +38,12 @@
 
 #define IPA_NAT_MAX_NUM_OF_INIT_CMD_DESC 4
 #define IPA_IPV6CT_MAX_NUM_OF_INIT_CMD_DESC 3
-#define IPA_MAX_NUM_OF_TABLE_DMA_CMD_DESC 5
+/*
+ * A TABLE_DMA chain is one ipa3_send_cmd() call, so it is bounded by
+ * IPA_SEND_MAX_DESC. The coal close and NOP ICs take two of those.
+ */
+#define IPA_MAX_NUM_OF_TABLE_DMA_CMD_DESC IPA_SEND_MAX_DESC
+#define IPA_TABLE_DMA_NUM_OF_HDR_CMD_DESC 2
 
 /*
  * The base table max entries is limited by index into table 13 bits number.
@@ -1866,7 +1871,8 @@ static uint32_t ipa3_nat_ipv6ct_calculate_table_size(
 
 static int ipa3_table_validate_table_dma_one(
 	enum ipa3_nat_mem_in        nmi,
-	struct ipa_ioc_nat_dma_one *param)
+	struct ipa_ioc_nat_dma_one *param,
+	uint32_t                   *table_sizes)
 {
 	uint32_t table_size;
 
@@ -1885,7 +1891,6 @@ static int ipa3_table_validate_table_dma_one(
 				ipa3_ctx->nat_mem.dev.name);
 			return -EPERM;
 		}
-		IPADBG("nmi(%s)\n", ipa3_nat_mem_in_as_str(nmi));
 		break;
 	case IPA_IPV6CT_BASE_TBL:
 	case IPA_IPV6CT_EXPN_TBL:
@@ -1906,9 +1911,14 @@ static int ipa3_table_validate_table_dma_one(
 		return -EPERM;
 	}
 
-	table_size = ipa3_nat_ipv6ct_calculate_table_size(
-		nmi,
-		param->base_addr);
+	/* entries of one batch mostly hit the same few tables */
+	table_size = table_sizes[param->base_addr];
+	if (!table_size) {
+		table_size = ipa3_nat_ipv6ct_calculate_table_size(
+			nmi,
+			param->base_addr);
+		table_sizes[param->base_addr] = table_size;
+	}
 
 	if (!table_size) {
 		IPAERR_RL("Failed to calculate table size for base_addr %d\n",
@@ -1927,85 +1937,51 @@ static int ipa3_table_validate_table_dma_one(
 	return 0;
 }
 
-
-/**
- * ipa3_table_dma_cmd() - Post TABLE_DMA command to IPA HW
- * @dma:	[in] initialization command attributes
- *
- * Called by NAT/IPv6CT clients to post TABLE_DMA command to IPA HW
- *
- * Returns:	0 on success, negative on failure
+/*
+ * Number of TABLE_DMA entries that fit one chain on APPS_CMD_PROD, after
+ * the coal close and NOP ICs. Mirrors the limits ipa3_send() enforces.
  */
-int ipa3_table_dma_cmd(
-	struct ipa_ioc_nat_dma_cmd *dma)
+static uint32_t ipa3_table_dma_max_entries_per_chain(void)
 {
-	struct ipa3_nat_ipv6ct_common_mem *dev = &ipa3_ctx->nat_mem.dev;
+	const struct ipa_gsi_ep_config *gsi_ep_cfg;
+	uint32_t max_desc = IPA_MAX_NUM_OF_TABLE_DMA_CMD_DESC;
+	uint32_t tlv;
 
-	enum ipahal_imm_cmd_name cmd_name = IPA_IMM_CMD_NAT_DMA;
+	gsi_ep_cfg = ipa3_get_gsi_ep_info(IPA_CLIENT_APPS_CMD_PROD);
+	if (gsi_ep_cfg) {
+		tlv = gsi_ep_cfg->ipa_if_tlv;
+		if (gsi_ep_cfg->prefetch_mode == GSI_SMART_PRE_FETCH ||
+			gsi_ep_cfg->prefetch_mode == GSI_FREE_PRE_FETCH)
+			tlv -= gsi_ep_cfg->prefetch_threshold;
+		max_desc = min_t(uint32_t, max_desc, tlv);
+	}
 
-	struct ipahal_imm_cmd_table_dma cmd;
-	struct ipahal_imm_cmd_pyld *cmd_pyld[IPA_MAX_NUM_OF_TABLE_DMA_CMD_DESC];
-	struct ipa3_desc desc[IPA_MAX_NUM_OF_TABLE_DMA_CMD_DESC];
+	if (max_desc <= IPA_TABLE_DMA_NUM_OF_HDR_CMD_DESC)
+		return 1;
 
-	uint8_t cnt, num_cmd = 0;
+	return max_desc - IPA_TABLE_DMA_NUM_OF_HDR_CMD_DESC;
+}
 
-	int result = 0;
-	int i;
+/*
+ * Build the descriptor chain for already validated entries, at most
+ * ipa3_table_dma_max_entries_per_chain() of them, sharing one coal close
+ * and NOP IC. Returns the number of descriptors used, or a negative errno.
+ * Payloads built so far are left in cmd_pyld for the caller to destroy.
+ */
+static int ipa3_table_dma_build_chain(
+	struct ipa_ioc_nat_dma_one *dma,
+	uint32_t entries,
+	struct ipahal_imm_cmd_pyld **cmd_pyld,
+	struct ipa3_desc *desc)
+{
+	enum ipahal_imm_cmd_name cmd_name = IPA_IMM_CMD_NAT_DMA;
+	struct ipahal_imm_cmd_table_dma cmd;
 	struct ipahal_reg_valmask valmask;
 	struct ipahal_imm_cmd_register_write reg_write_coal_close;
-	int max_dma_table_cmds = IPA_MAX_NUM_OF_TABLE_DMA_CMD_DESC;
-
-	IPADBG("In\n");
-
-	if (!sram_compatible)
-		dma->mem_type = 0;
-
-	if (!dev->is_dev_init) {
-		IPAERR_RL("NAT hasn't been initialized\n");
-		result = -EPERM;
-		goto bail;
-	}
-
-	if (!IPA_VALID_NAT_MEM_IN(dma->mem_type)) {
-		IPAERR_RL("Invalid ipa3_nat_mem_in type (%u)\n",
-				  dma->mem_type);
-		result = -EPERM;
-		goto bail;
-	}
-
-	IPADBG("nmi(%s)\n", ipa3_nat_mem_in_as_str(dma->mem_type));
+	uint32_t cnt, num_cmd = 0;
+	int i;
 
 	memset(&cmd, 0, sizeof(cmd));
-	memset(cmd_pyld, 0, sizeof(cmd_pyld));
-	memset(desc, 0, sizeof(desc));
-
-	/**
-	 * We use a descriptor for closing coalsceing endpoint
-	 * by immediate command. So, DMA entries should be less than
-	 * IPA_MAX_NUM_OF_TABLE_DMA_CMD_DESC - 1 to overcome
-	 * buffer overflow of ipa3_desc array.
-	 */
-	if (ipa3_get_ep_mapping(IPA_CLIENT_APPS_WAN_COAL_CONS) != -1)
-		max_dma_table_cmds -= 1;
-
-	if (!dma->entries || dma->entries > (max_dma_table_cmds - 1)) {
-		IPAERR_RL("Invalid number of entries %d\n",
-			dma->entries);
-		result = -EPERM;
-		goto bail;
-	}
-
-	for (cnt = 0; cnt < dma->entries; ++cnt) {
-
-		result = ipa3_table_validate_table_dma_one(
-			dma->mem_type, &dma->dma[cnt]);
-
-		if (result) {
-			IPAERR_RL("Table DMA command parameter %d is invalid\n",
-					  cnt);
-			goto bail;
-		}
-	}
 
 	/* IC to close the coal frame before HPS Clear if coal is enabled */
 	if (ipa3_get_ep_mapping(IPA_CLIENT_APPS_WAN_COAL_CONS) != -1
@@ -2030,8 +2006,7 @@ int ipa3_table_dma_cmd(
 			&reg_write_coal_close, false);
 		if (!cmd_pyld[num_cmd]) {
 			IPAERR("failed to construct coal close IC\n");
-			result = -ENOMEM;
-			goto destroy_imm_cmd;
+			return -ENOMEM;
 		}
 		ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
 		++num_cmd;
@@ -2045,8 +2020,7 @@ int ipa3_table_dma_cmd(
 
 	if (!cmd_pyld[num_cmd]) {
 		IPAERR("Failed to construct NOP imm cmd\n");
-		result = -ENOMEM;
-		goto destroy_imm_cmd;
+		return -ENOMEM;
 	}
 
 	ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
@@ -2059,20 +2033,19 @@ int ipa3_table_dma_cmd(
 	if (ipa3_ctx->ipa_hw_type >= IPA_HW_v4_0)
 		cmd_name = IPA_IMM_CMD_TABLE_DMA;
 
-	for (cnt = 0; cnt < dma->entries; ++cnt) {
+	for (cnt = 0; cnt < entries; ++cnt) {
 
-		cmd.table_index = dma->dma[cnt].table_index;
-		cmd.base_addr   = dma->dma[cnt].base_addr;
-		cmd.offset      = dma->dma[cnt].offset;
-		cmd.data        = dma->dma[cnt].data;
+		cmd.table_index = dma[cnt].table_index;
+		cmd.base_addr   = dma[cnt].base_addr;
+		cmd.offset      = dma[cnt].offset;
+		cmd.data        = dma[cnt].data;
 
 		cmd_pyld[num_cmd] =
 			ipahal_construct_imm_cmd(cmd_name, &cmd, false);
 
 		if (!cmd_pyld[num_cmd]) {
 			IPAERR_RL("Fail to construct table_dma imm cmd\n");
-			result = -ENOMEM;
-			goto destroy_imm_cmd;
+			return -ENOMEM;
 		}
 
 		ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
@@ -2080,14 +2053,144 @@ int ipa3_table_dma_cmd(
 		++num_cmd;
 	}
 
-	result = ipa3_send_cmd(num_cmd, desc);
+	return num_cmd;
+}
 
-	if (result)
-		IPAERR("Fail to send table_dma immediate command\n");
+/*
+ * Validate all entries and build every descriptor chain before sending
+ * any, so a bad entry or an allocation failure leaves the tables
+ * untouched. The chains are then sent in order, each paying for the coal
+ * close and NOP ICs only once.
+ *
+ * The batch is not atomic towards HW: when sending chain k fails, chains
+ * 0..k-1 were already applied. *applied returns the number of entries
+ * known to be written.
+ */
+static int ipa3_table_dma_send_batch(
+	enum ipa3_nat_mem_in nmi,
+	struct ipa_ioc_nat_dma_one *dma,
+	uint32_t entries,
+	uint32_t *applied)
+{
+	uint32_t table_sizes[IPA_IPV6CT_EXPN_TBL + 1] = { 0 };
+	struct ipahal_imm_cmd_pyld **cmd_pyld;
+	struct ipa3_desc *desc;
+	uint32_t *chain_len;
+	uint32_t cnt, chunk, max_chunk, num_chains, max_desc;
+	uint32_t chain, num_cmd = 0;
+	int result = 0;
+
+	*applied = 0;
+
+	for (cnt = 0; cnt < entries; ++cnt) {
+
+		result = ipa3_table_validate_table_dma_one(
+			nmi, &dma[cnt], table_sizes);
+
+		if (result) {
+			IPAERR_RL("Table DMA command parameter %d is invalid\n",
+				cnt);
+			return result;
+		}
+	}
+
+	max_chunk = ipa3_table_dma_max_entries_per_chain();
+	num_chains = DIV_ROUND_UP(entries, max_chunk);
+	max_desc = entries + num_chains * IPA_TABLE_DMA_NUM_OF_HDR_CMD_DESC;
+
+	cmd_pyld = kcalloc(max_desc, sizeof(*cmd_pyld), GFP_KERNEL);
+	desc = kcalloc(max_desc, sizeof(*desc), GFP_KERNEL);
+	chain_len = kcalloc(num_chains, sizeof(*chain_len), GFP_KERNEL);
+	if (!cmd_pyld || !desc || !chain_len) {
+		result = -ENOMEM;
+		goto free;
+	}
+
+	for (chain = 0, cnt = 0; cnt < entries; ++chain, cnt += chunk) {
+		chunk = min_t(uint32_t, entries - cnt, max_chunk);
+		result = ipa3_table_dma_build_chain(&dma[cnt], chunk,
+			&cmd_pyld[num_cmd], &desc[num_cmd]);
+		if (result < 0)
+			goto destroy_imm_cmd;
+		chain_len[chain] = result;
+		num_cmd += result;
+	}
+
+	num_cmd = 0;
+	for (chain = 0; chain < num_chains; ++chain) {
+		result = ipa3_send_cmd(chain_len[chain], &desc[num_cmd]);
+		if (result) {
+			IPAERR("Fail to send table_dma chain %u, %u/%u entries applied\n",
+				chain, *applied, entries);
+			break;
+		}
+		num_cmd += chain_len[chain];
+		*applied += min_t(uint32_t, entries - *applied, max_chunk);
+	}
 
 destroy_imm_cmd:
-	for (cnt = 0; cnt < num_cmd; ++cnt)
+	for (cnt = 0; cnt < max_desc; ++cnt)
 		ipahal_destroy_imm_cmd(cmd_pyld[cnt]);
+free:
+	kfree(chain_len);
+	kfree(desc);
+	kfree(cmd_pyld);
+
+	return result;
+}
+
+/**
+ * ipa3_table_dma_cmd() - Post TABLE_DMA command to IPA HW
+ * @dma:	[in/out] initialization command attributes
+ *
+ * Called by NAT/IPv6CT clients to post TABLE_DMA command to IPA HW
+ *
+ * Invalid entries fail the whole request before anything is written. A
+ * request split over several descriptor chains is not atomic though: if
+ * sending a later chain fails, dma->entries is set to the number of
+ * entries already applied.
+ *
+ * Returns:	0 on success, negative on failure
+ */
+int ipa3_table_dma_cmd(
+	struct ipa_ioc_nat_dma_cmd *dma)
+{
+	struct ipa3_nat_ipv6ct_common_mem *dev = &ipa3_ctx->nat_mem.dev;
+	uint32_t applied = 0;
+
+	int result = 0;
+
+	IPADBG("In\n");
+
+	if (!sram_compatible)
+		dma->mem_type = 0;
+
+	if (!dev->is_dev_init) {
+		IPAERR_RL("NAT hasn't been initialized\n");
+		result = -EPERM;
+		goto bail;
+	}
+
+	if (!IPA_VALID_NAT_MEM_IN(dma->mem_type)) {
+		IPAERR_RL("Invalid ipa3_nat_mem_in type (%u)\n",
+				  dma->mem_type);
+		result = -EPERM;
+		goto bail;
+	}
+
+	IPADBG("nmi(%s)\n", ipa3_nat_mem_in_as_str(dma->mem_type));
+
+	if (!dma->entries) {
+		IPAERR_RL("Invalid number of entries %d\n",
+			dma->entries);
+		result = -EPERM;
+		goto bail;
+	}
+
+	result = ipa3_table_dma_send_batch(dma->mem_type, dma->dma,
+		dma->entries, &applied);
+	if (result && applied)
+		dma->entries = applied;
 
 bail:
 	IPADBG("Out\n");
@@ -179,12 +179,6 @@ static int ipa_translate_rt_tbl_to_hw_fmt(enum ipa_ip_type ip,
 				goto err;
 			}
 
-			if (ipahal_fltrt_write_addr_to_hdr(tbl_mem.phys_base,
-				hdr, tbl->idx - apps_start_idx, true)) {
-				IPAERR_RL("fail to wrt sys tbl addr to hdr\n");
-				goto hdr_update_fail;
-			}
-
 			tbl_mem_buf = tbl_mem.base;
 
 			/* generate the rule-set */
@@ -201,6 +195,28 @@ static int ipa_translate_rt_tbl_to_hw_fmt(enum ipa_ip_type ip,
 				tbl_mem_buf += entry->hw_len;
 			}
 
+			/*
+			 * Keep the table HW already uses if it did not change,
+			 * so its header entry stays the same.
+			 */
+			if (ipa3_fltrt_sys_tbl_unchanged(&tbl->curr_mem[rlt],
+				&tbl_mem)) {
+				ipahal_free_dma_mem(&tbl_mem);
+				if (ipahal_fltrt_write_addr_to_hdr(
+					tbl->curr_mem[rlt].phys_base, hdr,
+					tbl->idx - apps_start_idx, true)) {
+					IPAERR_RL("fail to wrt sys tbl addr to hdr\n");
+					goto err;
+				}
+				continue;
+			}
+
+			if (ipahal_fltrt_write_addr_to_hdr(tbl_mem.phys_base,
+				hdr, tbl->idx - apps_start_idx, true)) {
+				IPAERR_RL("fail to wrt sys tbl addr to hdr\n");
+				goto hdr_update_fail;
+			}
+
 			if (tbl->curr_mem[rlt].phys_base) {
 				WARN_ON(tbl->prev_mem[rlt].phys_base);
 				tbl->prev_mem[rlt] = tbl->curr_mem[rlt];
@@ -480,6 +496,8 @@ int __ipa_commit_rt_v3(enum ipa_ip_type ip)
 	struct ipa3_rt_tbl *tbl;
 	u32 tbl_hdr_width;
 	struct ipahal_imm_cmd_register_write reg_write_coal_close;
+	struct ipa3_fltrt_shadow *sh = &ipa3_ctx->rt_shadow[ip];
+	int num_dma = 0;
 
 	tbl_hdr_width = ipahal_get_hw_tbl_hdr_width();
 	memset(desc, 0, sizeof(desc));
@@ -570,6 +588,8 @@ int __ipa_commit_rt_v3(enum ipa_ip_type ip)
 		goto fail_size_valid;
 	}
 
+	ipa3_fltrt_shadow_begin(sh);
+
 	/* IC to close the coal frame before HPS Clear if coal is enabled */
 	if (ipa3_get_ep_mapping(IPA_CLIENT_APPS_WAN_COAL_CONS) != -1
 		&& !ipa3_ctx->ulso_wa) {
@@ -643,26 +663,34 @@ int __ipa_commit_rt_v3(enum ipa_ip_type ip)
 		num_cmd++;
 	}
 
-	mem_cmd.is_read = false;
-	mem_cmd.skip_pipeline_clear = false;
-	mem_cmd.pipeline_clear_options = IPAHAL_HPS_CLEAR;
-	mem_cmd.size = alloc_params.nhash_hdr.size;
-	mem_cmd.system_addr = alloc_params.nhash_hdr.phys_base;
-	mem_cmd.local_addr = lcl_nhash_hdr;
-	cmd_pyld[num_cmd] = ipahal_construct_imm_cmd(
-		IPA_IMM_CMD_DMA_SHARED_MEM, &mem_cmd, false);
-	if (!cmd_pyld[num_cmd]) {
-		IPAERR("fail construct dma_shared_mem imm cmd. IP %d\n", ip);
-		goto fail_imm_cmd_construct;
+	if (ipa3_fltrt_shadow_changed(sh, &sh->hdr[IPA_RULE_NON_HASHABLE], 0,
+		alloc_params.nhash_hdr.base, alloc_params.nhash_hdr.size)) {
+		mem_cmd.is_read = false;
+		mem_cmd.skip_pipeline_clear = false;
+		mem_cmd.pipeline_clear_options = IPAHAL_HPS_CLEAR;
+		mem_cmd.size = alloc_params.nhash_hdr.size;
+		mem_cmd.system_addr = alloc_params.nhash_hdr.phys_base;
+		mem_cmd.local_addr = lcl_nhash_hdr;
+		cmd_pyld[num_cmd] = ipahal_construct_imm_cmd(
+			IPA_IMM_CMD_DMA_SHARED_MEM, &mem_cmd, false);
+		if (!cmd_pyld[num_cmd]) {
+			IPAERR("fail construct dma_shared_mem imm cmd. IP %d\n",
+				ip);
+			goto fail_imm_cmd_construct;
+		}
+		ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
+		num_cmd++;
+		num_dma++;
 	}
-	ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
-	num_cmd++;
 
 	/*
 	 * SRAM memory not allocated to hash tables. Sending
 	 * command to hash tables(filer/routing) operation not supported.
 	 */
-	if (!ipa3_ctx->ipa_fltrt_not_hashable) {
+	if (!ipa3_ctx->ipa_fltrt_not_hashable &&
+		ipa3_fltrt_shadow_changed(sh, &sh->hdr[IPA_RULE_HASHABLE], 0,
+			alloc_params.hash_hdr.base,
+			alloc_params.hash_hdr.size)) {
 		mem_cmd.is_read = false;
 		mem_cmd.skip_pipeline_clear = false;
 		mem_cmd.pipeline_clear_options = IPAHAL_HPS_CLEAR;
@@ -678,9 +706,12 @@ int __ipa_commit_rt_v3(enum ipa_ip_type ip)
 		}
 		ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
 		num_cmd++;
+		num_dma++;
 	}
 
-	if (lcl_nhash) {
+	if (lcl_nhash && ipa3_fltrt_shadow_changed(sh,
+		&sh->bdy[IPA_RULE_NON_HASHABLE], 0,
+		alloc_params.nhash_bdy.base, alloc_params.nhash_bdy.size)) {
 		if (num_cmd >= IPA_RT_MAX_NUM_OF_COMMIT_TABLES_CMD_DESC) {
 			IPAERR("number of commands is out of range: IP = %d\n",
 				ip);
@@ -703,8 +734,11 @@ int __ipa_commit_rt_v3(enum ipa_ip_type ip)
 		}
 		ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
 		num_cmd++;
+		num_dma++;
 	}
-	if (lcl_hash) {
+	if (lcl_hash && ipa3_fltrt_shadow_changed(sh,
+		&sh->bdy[IPA_RULE_HASHABLE], 0,
+		alloc_params.hash_bdy.base, alloc_params.hash_bdy.size)) {
 		if (num_cmd >= IPA_RT_MAX_NUM_OF_COMMIT_TABLES_CMD_DESC) {
 			IPAERR("number of commands is out of range: IP = %d\n",
 				ip);
@@ -727,9 +761,11 @@ int __ipa_commit_rt_v3(enum ipa_ip_type ip)
 		}
 		ipa3_init_imm_cmd_desc(&desc[num_cmd], cmd_pyld[num_cmd]);
 		num_cmd++;
+		num_dma++;
 	}
 
-	if (ipa3_send_cmd(num_cmd, desc)) {
+	/* Nothing changed in SRAM, no need to close coal or flush */
+	if (num_dma && ipa3_send_cmd(num_cmd, desc)) {
 		IPAERR_RL("fail to send immediate command\n");
 		rc = -EFAULT;
 		goto fail_imm_cmd_construct;
@@ -758,6 +794,7 @@ int __ipa_commit_rt_v3(enum ipa_ip_type ip)
 	}
 
 	__ipa_reap_sys_rt_tbls(ip);
+	ipa3_fltrt_shadow_end(sh);
 
 fail_imm_cmd_construct:
 	for (i = 0 ; i < num_cmd ; i++)
@@ -9788,6 +9788,127 @@ fail:
 	return result;
 }
 
+/**
+ * ipa3_fltrt_shadow_begin() - start a commit against a shadow
+ * @sh: the shadow of the FLT/RT family being committed
+ *
+ * The shadow is invalid until ipa3_fltrt_shadow_end() so that a failed
+ * commit forces a full write on the next one.
+ */
+void ipa3_fltrt_shadow_begin(struct ipa3_fltrt_shadow *sh)
+{
+	sh->cmp = sh->valid;
+	sh->valid = false;
+	sh->lost = false;
+	sh->commits++;
+}
+
+/**
+ * ipa3_fltrt_shadow_changed() - check whether an image region needs DMA
+ * @sh: the shadow of the FLT/RT family being committed
+ * @buf: the shadow region
+ * @ofst: offset of the region inside @buf
+ * @img: the new image
+ * @len: length of the new image
+ *
+ * Records @img in the shadow when it differs from what SRAM holds.
+ *
+ * Return: true if the region has to be written, false if SRAM already
+ *  holds the same bytes
+ */
+bool ipa3_fltrt_shadow_changed(struct ipa3_fltrt_shadow *sh,
+	struct ipa3_fltrt_shadow_buf *buf, u32 ofst, const void *img, u32 len)
+{
+	bool grown = false;
+	u8 *base;
+
+	if (ofst + len > buf->size) {
+		base = krealloc(buf->base, ofst + len, GFP_ATOMIC);
+		if (!base) {
+			sh->lost = true;
+			sh->dma_sent++;
+			return true;
+		}
+		memset(base + buf->size, 0, ofst + len - buf->size);
+		buf->base = base;
+		buf->size = ofst + len;
+		grown = true;
+	}
+
+	if (sh->cmp && !grown && !memcmp(buf->base + ofst, img, len)) {
+		sh->dma_skipped++;
+		return false;
+	}
+
+	memcpy(buf->base + ofst, img, len);
+	sh->dma_sent++;
+	return true;
+}
+
+/**
+ * ipa3_fltrt_shadow_end() - mark a commit as written to SRAM
+ * @sh: the shadow of the FLT/RT family that was committed
+ */
+void ipa3_fltrt_shadow_end(struct ipa3_fltrt_shadow *sh)
+{
+	sh->valid = !sh->lost;
+}
+
+/**
+ * ipa3_fltrt_shadow_invalidate() - forget what apps wrote to SRAM
+ *
+ * To be called whenever the FLT/RT SRAM partitions are re-initialized.
+ */
+void ipa3_fltrt_shadow_invalidate(void)
+{
+	int ip;
+
+	for (ip = 0; ip < IPA_IP_MAX; ip++) {
+		ipa3_ctx->flt_shadow[ip].valid = false;
+		ipa3_ctx->rt_shadow[ip].valid = false;
+	}
+}
+
+/**
+ * ipa3_fltrt_shadow_free() - release the FLT/RT shadow copies
+ */
+void ipa3_fltrt_shadow_free(void)
+{
+	struct ipa3_fltrt_shadow *sh;
+	int ip, rlt;
+
+	for (ip = 0; ip < IPA_IP_MAX; ip++) {
+		sh = &ipa3_ctx->flt_shadow[ip];
+		for (rlt = 0; rlt < IPA_RULE_TYPE_MAX; rlt++) {
+			kfree(sh->hdr[rlt].base);
+			kfree(sh->bdy[rlt].base);
+		}
+		memset(sh, 0, sizeof(*sh));
+
+		sh = &ipa3_ctx->rt_shadow[ip];
+		for (rlt = 0; rlt < IPA_RULE_TYPE_MAX; rlt++) {
+			kfree(sh->hdr[rlt].base);
+			kfree(sh->bdy[rlt].base);
+		}
+		memset(sh, 0, sizeof(*sh));
+	}
+}
+
+/**
+ * ipa3_fltrt_sys_tbl_unchanged() - compare a new system table with the
+ *  one HW currently uses
+ * @curr: the table in use, may be empty
+ * @mem: the newly generated table
+ *
+ * Return: true if both tables hold the same rules
+ */
+bool ipa3_fltrt_sys_tbl_unchanged(struct ipa_mem_buffer *curr,
+	struct ipa_mem_buffer *mem)
+{
+	return curr->phys_base && curr->size == mem->size &&
+		!memcmp(curr->base, mem->base, mem->size);
+}
+
 /**
  * ipa3_dump_buff_internal() - dumps buffer for debug purposes
  * @base: buffer base address
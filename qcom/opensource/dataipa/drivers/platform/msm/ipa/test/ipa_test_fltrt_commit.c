@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Copyright (c) 2026 Qualcomm Innovation Center, Inc. All rights reserved.
+ */
+
+#include <linux/ktime.h>
+#include "ipa_ut_framework.h"
+#include "ipa_i.h"
+
+/* num_hdls of struct ipa_ioc_del_flt_rule is u8 */
+#define IPA_TEST_FLTRT_COMMIT_MAX_RULES 254
+#define IPA_TEST_FLTRT_COMMIT_BASE_PORT 7000
+
+static const u32 ipa_test_fltrt_commit_sizes[] = { 8, 64, 128 };
+
+struct ipa_test_fltrt_commit_ctx {
+	u32 hdl[IPA_TEST_FLTRT_COMMIT_MAX_RULES];
+	u32 num_hdls;
+};
+
+static struct ipa_test_fltrt_commit_ctx *ctx;
+
+static int ipa_test_fltrt_commit_suite_setup(void **ppriv)
+{
+	IPA_UT_DBG("Start Setup\n");
+
+	if (!ctx)
+		ctx = kzalloc(sizeof(*ctx), GFP_KERNEL);
+	if (!ctx)
+		return -ENOMEM;
+
+	return 0;
+}
+
+static int ipa_test_fltrt_commit_suite_teardown(void *priv)
+{
+	IPA_UT_DBG("Start Teardown\n");
+
+	kfree(ctx);
+	ctx = NULL;
+
+	return 0;
+}
+
+static int ipa_test_fltrt_commit_add(u32 num, u32 port, bool commit)
+{
+	struct ipa_ioc_add_flt_rule_v2 *flt_rule;
+	struct ipa_flt_rule_add_v2 *rules;
+	int ret = 0;
+	u32 i;
+
+	if (ctx->num_hdls + num > IPA_TEST_FLTRT_COMMIT_MAX_RULES)
+		return -EINVAL;
+
+	flt_rule = kzalloc(sizeof(*flt_rule), GFP_KERNEL);
+	if (!flt_rule)
+		return -ENOMEM;
+
+	rules = kcalloc(num, sizeof(*rules), GFP_KERNEL);
+	if (!rules) {
+		ret = -ENOMEM;
+		goto free_flt;
+	}
+
+	flt_rule->commit = commit;
+	flt_rule->ip = IPA_IP_v4;
+	flt_rule->ep = IPA_CLIENT_USB_PROD;
+	flt_rule->num_rules = num;
+	flt_rule->rules = (uint64_t)rules;
+	for (i = 0; i < num; i++) {
+		rules[i].at_rear = 1;
+		rules[i].rule.action = IPA_PASS_TO_EXCEPTION;
+		rules[i].rule.attrib.attrib_mask = IPA_FLT_DST_PORT;
+		rules[i].rule.attrib.dst_port = port + i;
+		rules[i].rule.hashable = 1;
+	}
+
+	if (ipa3_add_flt_rule_v2(flt_rule)) {
+		IPA_UT_ERR("failed to add %u flt rules\n", num);
+		ret = -EFAULT;
+	}
+
+	for (i = 0; i < num; i++) {
+		if (rules[i].status) {
+			IPA_UT_ERR("flt rule %u status %d\n", i, rules[i].status);
+			ret = -EFAULT;
+			continue;
+		}
+		ctx->hdl[ctx->num_hdls++] = rules[i].flt_rule_hdl;
+	}
+
+	kfree(rules);
+free_flt:
+	kfree(flt_rule);
+	return ret;
+}
+
+static int ipa_test_fltrt_commit_del_all(void)
+{
+	struct ipa_ioc_del_flt_rule *del;
+	int ret = 0;
+	u32 i;
+
+	if (!ctx->num_hdls)
+		return 0;
+
+	del = kzalloc(sizeof(*del) +
+		ctx->num_hdls * sizeof(struct ipa_flt_rule_del), GFP_KERNEL);
+	if (!del)
+		return -ENOMEM;
+
+	del->commit = 1;
+	del->ip = IPA_IP_v4;
+	del->num_hdls = ctx->num_hdls;
+	for (i = 0; i < ctx->num_hdls; i++)
+		del->hdl[i].hdl = ctx->hdl[i];
+
+	if (ipa3_del_flt_rule(del)) {
+		IPA_UT_ERR("failed to delete flt rules\n");
+		ret = -EFAULT;
+	}
+	ctx->num_hdls = 0;
+
+	kfree(del);
+	return ret;
+}
+
+static int ipa_test_fltrt_commit_timed(s64 *usec)
+{
+	ktime_t start;
+	int ret;
+
+	start = ktime_get();
+	ret = ipa3_commit_flt(IPA_IP_v4);
+	*usec = ktime_us_delta(ktime_get(), start);
+
+	return ret;
+}
+
+static int ipa_test_fltrt_commit_run(u32 num)
+{
+	struct ipa3_fltrt_shadow *sh = &ipa3_ctx->flt_shadow[IPA_IP_v4];
+	s64 full_us, noop_us, incr_us;
+	u64 sent;
+
+	if (ipa_test_fltrt_commit_add(num, IPA_TEST_FLTRT_COMMIT_BASE_PORT,
+		false)) {
+		IPA_UT_TEST_FAIL_REPORT("fail to add flt rules");
+		goto fail;
+	}
+
+	if (ipa_test_fltrt_commit_timed(&full_us)) {
+		IPA_UT_TEST_FAIL_REPORT("full commit failed");
+		goto fail;
+	}
+
+	sent = sh->dma_sent;
+	if (ipa_test_fltrt_commit_timed(&noop_us)) {
+		IPA_UT_TEST_FAIL_REPORT("no-op commit failed");
+		goto fail;
+	}
+	if (sh->dma_sent != sent) {
+		IPA_UT_LOG("no-op commit sent %llu DMA regions\n",
+			sh->dma_sent - sent);
+		IPA_UT_TEST_FAIL_REPORT("no-op commit was not skipped");
+		goto fail;
+	}
+
+	if (ipa_test_fltrt_commit_add(1,
+		IPA_TEST_FLTRT_COMMIT_BASE_PORT + num, false)) {
+		IPA_UT_TEST_FAIL_REPORT("fail to add flt rule");
+		goto fail;
+	}
+
+	sent = sh->dma_sent;
+	if (ipa_test_fltrt_commit_timed(&incr_us)) {
+		IPA_UT_TEST_FAIL_REPORT("incremental commit failed");
+		goto fail;
+	}
+
+	IPA_UT_LOG("rules=%u full=%lldus noop=%lldus incr=%lldus dma=%llu\n",
+		num, full_us, noop_us, incr_us, sh->dma_sent - sent);
+
+	if (ipa_test_fltrt_commit_del_all()) {
+		IPA_UT_TEST_FAIL_REPORT("fail to delete flt rules");
+		return -EFAULT;
+	}
+
+	return 0;
+
+fail:
+	ipa_test_fltrt_commit_del_all();
+	return -EFAULT;
+}
+
+static int ipa_test_fltrt_commit_latency(void *priv)
+{
+	int i;
+
+	if (ipa3_get_ep_mapping(IPA_CLIENT_USB_PROD) ==
+		IPA_EP_NOT_ALLOCATED) {
+		IPA_UT_LOG("USB_PROD is not mapped, nothing to test\n");
+		return 0;
+	}
+
+	for (i = 0; i < ARRAY_SIZE(ipa_test_fltrt_commit_sizes); i++) {
+		if (ipa_test_fltrt_commit_run(ipa_test_fltrt_commit_sizes[i]))
+			return -EFAULT;
+	}
+
+	IPA_UT_LOG("flt v4 shadow: commits=%llu sent=%llu skipped=%llu\n",
+		ipa3_ctx->flt_shadow[IPA_IP_v4].commits,
+		ipa3_ctx->flt_shadow[IPA_IP_v4].dma_sent,
+		ipa3_ctx->flt_shadow[IPA_IP_v4].dma_skipped);
+
+	return 0;
+}
+
+/* Suite definition block */
+IPA_UT_DEFINE_SUITE_START(fltrt_commit, "FLT/RT commit latency test",
+	ipa_test_fltrt_commit_suite_setup, ipa_test_fltrt_commit_suite_teardown)
+{
+	IPA_UT_ADD_TEST(commit_latency,
+		"Full, no-op and incremental v4 flt commit latency",
+		ipa_test_fltrt_commit_latency, false, IPA_HW_v4_0, IPA_HW_MAX),
+
+} IPA_UT_DEFINE_SUITE_END(fltrt_commit);
@@ -18,6 +18,7 @@ IPA_UT_DECLARE_SUITE(dma);
 IPA_UT_DECLARE_SUITE(pm);
 IPA_UT_DECLARE_SUITE(example);
 IPA_UT_DECLARE_SUITE(hw_stats);
+IPA_UT_DECLARE_SUITE(fltrt_commit);
 IPA_UT_DECLARE_SUITE(wdi3);
 IPA_UT_DECLARE_SUITE(ntn);
 IPA_UT_DECLARE_SUITE(wdi3m);
@@ -35,6 +36,7 @@ IPA_UT_DEFINE_ALL_SUITES_START
 	IPA_UT_REGISTER_SUITE(pm),
 	IPA_UT_REGISTER_SUITE(example),
 	IPA_UT_REGISTER_SUITE(hw_stats),
+	IPA_UT_REGISTER_SUITE(fltrt_commit),
 	IPA_UT_REGISTER_SUITE(wdi3),
 	IPA_UT_REGISTER_SUITE(ntn),
 	IPA_UT_REGISTER_SUITE(wdi3m),
@@ -156,34 +156,39 @@ DATARMNET144d119066.DATARMNET7fa8b2acbf==DATARMNETfd5c3d30e5)DATARMNETaa568481cf
 DATARMNET1ef22e4c76;list_add_tail(&DATARMNET5fe4c722a8->DATARMNET719f68fb88->
 list,&DATARMNETaa568481cf->DATARMNETb76b79d0d5);DATARMNETaa568481cf->
 DATARMNET1db11fa85e++;DATARMNETaa568481cf->DATARMNETcf28ae376b+=
-DATARMNET5fe4c722a8->DATARMNET1ef22e4c76;}bool DATARMNETfbf5798e15(struct 
-DATARMNETd812bcdbb5*DATARMNET5fe4c722a8,struct list_head*DATARMNET6f9bfa17e6){
-struct DATARMNETd7c9631acd*DATARMNETaa568481cf;bool DATARMNET885970f252=false;u8
+DATARMNET5fe4c722a8->DATARMNET1ef22e4c76;}static void DATARMNET434332c24c(u32 
+DATARMNETfd61942603){DATARMNETbad3b5165e(DATARMNET83c601e075,DATARMNETfd61942603
+);DATARMNET0e17a695e0(DATARMNET0bba340540,DATARMNETfd61942603);}bool 
+DATARMNETfbf5798e15(struct DATARMNETd812bcdbb5*DATARMNET5fe4c722a8,struct 
+list_head*DATARMNET6f9bfa17e6){struct DATARMNETd7c9631acd*DATARMNETaa568481cf;
+bool DATARMNET885970f252=false;u32 DATARMNETfd61942603=(0xd2d+202-0xdf7);u8
  DATARMNET9695aa5b1d=DATARMNET5fe4c722a8->DATARMNET144d119066.
 DATARMNET7fa8b2acbf;if(!DATARMNET2013036d80(DATARMNET9695aa5b1d)){
-DATARMNETa00cda79d0(DATARMNET6a894ab63d);return false;}hash_for_each_possible(
-DATARMNET4791268d67,DATARMNETaa568481cf,DATARMNETbd5d7d96d8,DATARMNET5fe4c722a8
-->DATARMNET645e8912b8){bool DATARMNET2dd83daa1c;if(!DATARMNET6895620058(
-DATARMNETaa568481cf,DATARMNET5fe4c722a8))continue;DATARMNETc6f994577c:
-DATARMNET2dd83daa1c=DATARMNET5a0f9fc3a2(DATARMNETaa568481cf,DATARMNET5fe4c722a8)
-;DATARMNET5fe4c722a8->DATARMNETf1b6b0a6cc=true;DATARMNET885970f252=true;switch(
-DATARMNET9695aa5b1d){case DATARMNETfd5c3d30e5:return DATARMNET4c7cdc25b7(
-DATARMNETaa568481cf,DATARMNET5fe4c722a8,DATARMNET2dd83daa1c,DATARMNET6f9bfa17e6)
-;case DATARMNETa656f324b2:return DATARMNET8dc47eb7af(DATARMNETaa568481cf,
+DATARMNETa00cda79d0(DATARMNET6a894ab63d);return false;}DATARMNETa00cda79d0(
+DATARMNET013affdd57);hash_for_each_possible(DATARMNET4791268d67,
+DATARMNETaa568481cf,DATARMNETbd5d7d96d8,DATARMNET5fe4c722a8->DATARMNET645e8912b8
+){bool DATARMNET2dd83daa1c;DATARMNETfd61942603++;if(!DATARMNET6895620058(
+DATARMNETaa568481cf,DATARMNET5fe4c722a8))continue;DATARMNET434332c24c(
+DATARMNETfd61942603);DATARMNETc6f994577c:DATARMNET2dd83daa1c=DATARMNET5a0f9fc3a2
+(DATARMNETaa568481cf,DATARMNET5fe4c722a8);DATARMNET5fe4c722a8->
+DATARMNETf1b6b0a6cc=true;DATARMNET885970f252=true;switch(DATARMNET9695aa5b1d){
+case DATARMNETfd5c3d30e5:return DATARMNET4c7cdc25b7(DATARMNETaa568481cf,
+DATARMNET5fe4c722a8,DATARMNET2dd83daa1c,DATARMNET6f9bfa17e6);case 
+DATARMNETa656f324b2:return DATARMNET8dc47eb7af(DATARMNETaa568481cf,
 DATARMNET5fe4c722a8,DATARMNET2dd83daa1c,DATARMNET6f9bfa17e6);default:return 
-false;}}if(!DATARMNET885970f252){DATARMNETaa568481cf=DATARMNETd41def0046();
-DATARMNETaa568481cf->DATARMNET381f1cadc4=DATARMNET5fe4c722a8->
-DATARMNET645e8912b8;hash_add(DATARMNET4791268d67,&DATARMNETaa568481cf->
-DATARMNETbd5d7d96d8,DATARMNETaa568481cf->DATARMNET381f1cadc4);goto 
-DATARMNETc6f994577c;}return false;}void DATARMNETb98b78b8e3(void){struct 
-DATARMNETd7c9631acd*DATARMNETaa568481cf;struct hlist_node*DATARMNET0386f6f82a;
-int DATARMNETae0201901a;hash_for_each_safe(DATARMNET4791268d67,
-DATARMNETae0201901a,DATARMNET0386f6f82a,DATARMNETaa568481cf,DATARMNETbd5d7d96d8)
-hash_del(&DATARMNETaa568481cf->DATARMNETbd5d7d96d8);}int DATARMNETdbcaf01255(
-void){struct DATARMNET70f3b87b5d*DATARMNETe05748b000=DATARMNETc2a630b113();u8 
-DATARMNETefc9df3df2;for(DATARMNETefc9df3df2=(0xd2d+202-0xdf7);
-DATARMNETefc9df3df2<DATARMNET78d9393ac8;DATARMNETefc9df3df2++){struct 
-DATARMNETd7c9631acd*DATARMNETaa568481cf;DATARMNETaa568481cf=&DATARMNETe05748b000
-->DATARMNETebb45c8d86.DATARMNET2846a01cce[DATARMNETefc9df3df2];INIT_LIST_HEAD(&
-DATARMNETaa568481cf->DATARMNETb76b79d0d5);INIT_HLIST_NODE(&DATARMNETaa568481cf->
-DATARMNETbd5d7d96d8);}return DATARMNET0529bb9c4e;}
+false;}}if(!DATARMNET885970f252){DATARMNET434332c24c(DATARMNETfd61942603);
+DATARMNETaa568481cf=DATARMNETd41def0046();DATARMNETaa568481cf->
+DATARMNET381f1cadc4=DATARMNET5fe4c722a8->DATARMNET645e8912b8;hash_add(
+DATARMNET4791268d67,&DATARMNETaa568481cf->DATARMNETbd5d7d96d8,
+DATARMNETaa568481cf->DATARMNET381f1cadc4);goto DATARMNETc6f994577c;}return false
+;}void DATARMNETb98b78b8e3(void){struct DATARMNETd7c9631acd*DATARMNETaa568481cf;
+struct hlist_node*DATARMNET0386f6f82a;int DATARMNETae0201901a;hash_for_each_safe
+(DATARMNET4791268d67,DATARMNETae0201901a,DATARMNET0386f6f82a,DATARMNETaa568481cf
+,DATARMNETbd5d7d96d8)hash_del(&DATARMNETaa568481cf->DATARMNETbd5d7d96d8);}int 
+DATARMNETdbcaf01255(void){struct DATARMNET70f3b87b5d*DATARMNETe05748b000=
+DATARMNETc2a630b113();u8 DATARMNETefc9df3df2;for(DATARMNETefc9df3df2=
+(0xd2d+202-0xdf7);DATARMNETefc9df3df2<DATARMNET78d9393ac8;DATARMNETefc9df3df2++)
+{struct DATARMNETd7c9631acd*DATARMNETaa568481cf;DATARMNETaa568481cf=&
+DATARMNETe05748b000->DATARMNETebb45c8d86.DATARMNET2846a01cce[DATARMNETefc9df3df2
+];INIT_LIST_HEAD(&DATARMNETaa568481cf->DATARMNETb76b79d0d5);INIT_HLIST_NODE(&
+DATARMNETaa568481cf->DATARMNETbd5d7d96d8);}return DATARMNET0529bb9c4e;}
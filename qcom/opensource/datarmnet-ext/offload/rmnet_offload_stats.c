@@ -17,4 +17,8 @@ rmnet_offload_stat,DATARMNET6c78aba0c8,ullong,NULL,(0xcb7+5769-0x221c));void
 DATARMNETbad3b5165e(u32 DATARMNET248f120dd5,u64 DATARMNETb639f6e1b1){if(
 DATARMNET248f120dd5<DATARMNETd04f96aa13)DATARMNET6c78aba0c8[DATARMNET248f120dd5]
 +=DATARMNETb639f6e1b1;}void DATARMNETa00cda79d0(u32 DATARMNET248f120dd5){
-DATARMNETbad3b5165e(DATARMNET248f120dd5,(0xd26+209-0xdf6));}
+DATARMNETbad3b5165e(DATARMNET248f120dd5,(0xd26+209-0xdf6));}void 
+DATARMNET0e17a695e0(u32 DATARMNET872c4d190b,u64 DATARMNETfa822f35af){if(
+DATARMNET872c4d190b<DATARMNETd04f96aa13&&DATARMNET6c78aba0c8[DATARMNET872c4d190b
+]<DATARMNETfa822f35af)DATARMNET6c78aba0c8[DATARMNET872c4d190b]=
+DATARMNETfa822f35af;}
@@ -20,8 +20,9 @@ DATARMNETddf572458d,DATARMNET47a963957c,DATARMNETb322de38be,DATARMNET38317c7efd,
 DATARMNET31c0e41f5a,DATARMNET0cd1fa0d98,DATARMNET1c0d243816,DATARMNETc34a778ea2,
 DATARMNETbc56977b7e,DATARMNETc9b8ef90d1,DATARMNET92f3434694,DATARMNETa76d93355c,
 DATARMNET3067ea3199,DATARMNETf335e26298,DATARMNET8e1480cff2,DATARMNET787b04223a,
-DATARMNETa121404606,DATARMNETd04f96aa13,};void DATARMNETbad3b5165e(u32 
-DATARMNET248f120dd5,u64 DATARMNETb639f6e1b1);void DATARMNETa00cda79d0(u32 
-DATARMNET248f120dd5);
+DATARMNETa121404606,DATARMNET013affdd57,DATARMNET83c601e075,DATARMNET0bba340540,
+DATARMNETd04f96aa13,};void DATARMNETbad3b5165e(u32 DATARMNET248f120dd5,u64 
+DATARMNETb639f6e1b1);void DATARMNETa00cda79d0(u32 DATARMNET248f120dd5);void 
+DATARMNET0e17a695e0(u32 DATARMNET872c4d190b,u64 DATARMNETfa822f35af);
 #endif
 
@@ -18,6 +18,9 @@
 #include <linux/skbuff.h>
 #include <linux/rtnetlink.h>
 #include <net/pkt_sched.h>
+#include <net/codel.h>
+#include <net/codel_impl.h>
+#include <net/codel_qdisc.h>
 static char*verinfo[]={"\x37\x34\x31\x35\x39\x32\x31\x63",
 "\x61\x65\x32\x34\x34\x61\x39\x64"};module_param_array(verinfo,charp,NULL,
 (0xcb7+5769-0x221c));MODULE_PARM_DESC(verinfo,
@@ -28,77 +31,175 @@ static const u8 DATARMNET93bdeed8cb[TC_PRIO_MAX+(0xd26+209-0xdf6)]={
 (0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4),
 (0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd2d+202-0xdf7),(0xd26+209-0xdf6),
 (0xd1f+216-0xdf5),(0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4),
-(0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4)};static 
-const int DATARMNET91bbdde74c[DATARMNETe632b2e0b0]={(0xbf7+4421-0x1c3c)*
-(0xdf7+2629-0x143c),(0xef7+694-0x112d)*(0xdf7+2629-0x143c),(0xef7+1142-0x132d)*
-(0xdf7+2629-0x143c),(0xeb7+1174-0x132d)*(0xdf7+2629-0x143c)};static const int 
-DATARMNET9dd1382d86[DATARMNETe632b2e0b0]={(0xd35+210-0xdff),(0xd03+244-0xdf1),
-(0xd11+230-0xdf3),(0xd1f+216-0xdf5)};struct DATARMNET74e95d25df{struct 
+(0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4)};
+static const int DATARMNET9dd1382d86[DATARMNETe632b2e0b0]={(0xd35+210-0xdff),
+(0xd03+244-0xdf1),(0xd11+230-0xdf3),(0xd1f+216-0xdf5)};
+#define DATARMNETe137f717a9 ((0xd27+224-0xdfd))
+#define DATARMNET2b6f2fd7c0 ((0xdf7+6169-0x241c))
+#define DATARMNET84b7d0a475 ((0xef7+1142-0x132d))
+#define DATARMNET99f8ed907b ((0x25f8+1428-0x1804))
+#define DATARMNET9e8c324649 (100000)
+#define DATARMNET3e1d210d76 (BIT((0xd1f+216-0xdf5))|BIT((0xd18+223-0xdf4)))
+struct DATARMNET9b564234fc{u32 DATARMNET2ca7d9963d[DATARMNETe632b2e0b0];u32 
+DATARMNET55a0b8e08d;u32 DATARMNET6ea6ea386f;u32 DATARMNETde3e96e664;};struct 
+DATARMNET49e452e798{u32 DATARMNET12dd0e4de9[DATARMNETe632b2e0b0][
+DATARMNETe137f717a9];u32 DATARMNET3d76e9ac11[DATARMNETe632b2e0b0];u32 
+DATARMNETf0483f28c0[DATARMNETe632b2e0b0];};struct DATARMNET74e95d25df{struct 
 qdisc_skb_head DATARMNETb4180393e4[DATARMNETe632b2e0b0];int DATARMNET1de7b3d891[
-DATARMNETe632b2e0b0];int DATARMNETf9afebb887[DATARMNETe632b2e0b0];};static int 
-DATARMNET3a797cc4e9(struct sk_buff*DATARMNET543491eb0f,struct Qdisc*
-DATARMNET9b0193c8c4,struct sk_buff**DATARMNET6af05df5b3){struct 
-DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(DATARMNET9b0193c8c4);unsigned
- int DATARMNET5affe290b8=qdisc_pkt_len(DATARMNET543491eb0f);struct 
-qdisc_skb_head*q;if(likely(DATARMNET9b0193c8c4->q.qlen<qdisc_dev(
-DATARMNET9b0193c8c4)->tx_queue_len)){q=&DATARMNETe823dcf978->DATARMNETb4180393e4
-[DATARMNET93bdeed8cb[DATARMNET543491eb0f->priority&TC_PRIO_MAX]];
-__qdisc_enqueue_tail(DATARMNET543491eb0f,q);qdisc_update_stats_at_enqueue(
-DATARMNET9b0193c8c4,DATARMNET5affe290b8);return NET_XMIT_SUCCESS;}return 
-qdisc_drop(DATARMNET543491eb0f,DATARMNET9b0193c8c4,DATARMNET6af05df5b3);}static 
-u8 DATARMNETf9ac3daa83(struct DATARMNET74e95d25df*DATARMNETe823dcf978){int 
-DATARMNET2372d14a3d,DATARMNET70fa801d65=DATARMNETe632b2e0b0;for(
-DATARMNET2372d14a3d=(0xd2d+202-0xdf7);DATARMNET2372d14a3d<DATARMNETe632b2e0b0;
-DATARMNET2372d14a3d++){if(!DATARMNETe823dcf978->DATARMNETb4180393e4[
-DATARMNET2372d14a3d].qlen)continue;if(DATARMNETe823dcf978->DATARMNET1de7b3d891[
-DATARMNET2372d14a3d]<=(0xd2d+202-0xdf7)||DATARMNETe823dcf978->
-DATARMNETf9afebb887[DATARMNET2372d14a3d]<=(0xd2d+202-0xdf7)){if(
-DATARMNET2372d14a3d<DATARMNET70fa801d65)DATARMNET70fa801d65=DATARMNET2372d14a3d;
-continue;}return DATARMNET2372d14a3d;}for(DATARMNET2372d14a3d=(0xd2d+202-0xdf7);
-DATARMNET2372d14a3d<DATARMNETe632b2e0b0;DATARMNET2372d14a3d++){
-DATARMNETe823dcf978->DATARMNET1de7b3d891[DATARMNET2372d14a3d]=
-DATARMNET9dd1382d86[DATARMNET2372d14a3d];DATARMNETe823dcf978->
-DATARMNETf9afebb887[DATARMNET2372d14a3d]=DATARMNET91bbdde74c[DATARMNET2372d14a3d
-];}return DATARMNET70fa801d65;}static struct sk_buff*DATARMNET11bbc6360d(struct 
-Qdisc*DATARMNET9b0193c8c4){struct DATARMNET74e95d25df*DATARMNETe823dcf978=
-qdisc_priv(DATARMNET9b0193c8c4);struct sk_buff*DATARMNET543491eb0f=NULL;u8 
-DATARMNET2372d14a3d;DATARMNET2372d14a3d=DATARMNETf9ac3daa83(DATARMNETe823dcf978)
-;if(DATARMNET2372d14a3d<DATARMNETe632b2e0b0){DATARMNET543491eb0f=
-__qdisc_dequeue_head(&DATARMNETe823dcf978->DATARMNETb4180393e4[
-DATARMNET2372d14a3d]);if(likely(DATARMNET543491eb0f)){DATARMNETe823dcf978->
-DATARMNET1de7b3d891[DATARMNET2372d14a3d]--;DATARMNETe823dcf978->
-DATARMNETf9afebb887[DATARMNET2372d14a3d]-=qdisc_pkt_len(DATARMNET543491eb0f);
-qdisc_update_stats_at_dequeue(DATARMNET9b0193c8c4,DATARMNET543491eb0f);}}return 
-DATARMNET543491eb0f;}static struct sk_buff*DATARMNET5842e6aac7(struct Qdisc*
+DATARMNETe632b2e0b0];u32 DATARMNET2ca7d9963d[DATARMNETe632b2e0b0];u32 
+DATARMNETbcbe9da643[DATARMNETe632b2e0b0];u32 DATARMNETde3e96e664;u8 
+DATARMNETd32b713fa1;struct codel_params DATARMNETc745a5579f;struct codel_vars 
+DATARMNET4e0c0bbe9b[DATARMNETe632b2e0b0];struct codel_stats DATARMNET86d1292b6e;
+struct DATARMNET49e452e798 DATARMNET7a018f9b54;};static int DATARMNET3a797cc4e9(
+struct sk_buff*DATARMNET543491eb0f,struct Qdisc*DATARMNET9b0193c8c4,struct 
+sk_buff**DATARMNET6af05df5b3){struct DATARMNET74e95d25df*DATARMNETe823dcf978=
+qdisc_priv(DATARMNET9b0193c8c4);unsigned int DATARMNET5affe290b8=qdisc_pkt_len(
+DATARMNET543491eb0f);struct qdisc_skb_head*q;if(likely(DATARMNET9b0193c8c4->q.
+qlen<qdisc_dev(DATARMNET9b0193c8c4)->tx_queue_len)){q=&DATARMNETe823dcf978->
+DATARMNETb4180393e4[DATARMNET93bdeed8cb[DATARMNET543491eb0f->priority&
+TC_PRIO_MAX]];codel_set_enqueue_time(DATARMNET543491eb0f);__qdisc_enqueue_tail(
+DATARMNET543491eb0f,q);qdisc_update_stats_at_enqueue(DATARMNET9b0193c8c4,
+DATARMNET5affe290b8);return NET_XMIT_SUCCESS;}return qdisc_drop(
+DATARMNET543491eb0f,DATARMNET9b0193c8c4,DATARMNET6af05df5b3);}static struct 
+sk_buff*DATARMNET03f8fa36cc(struct codel_vars*DATARMNETe187b6100e,void*
+DATARMNET693dd65373){struct Qdisc*DATARMNET9b0193c8c4=DATARMNET693dd65373;struct
+ DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(DATARMNET9b0193c8c4);struct 
+sk_buff*DATARMNET543491eb0f;DATARMNET543491eb0f=__qdisc_dequeue_head(&
+DATARMNETe823dcf978->DATARMNETb4180393e4[DATARMNETe187b6100e-DATARMNETe823dcf978
+->DATARMNET4e0c0bbe9b]);if(DATARMNET543491eb0f){DATARMNET9b0193c8c4->q.qlen--;
+qdisc_qstats_backlog_dec(DATARMNET9b0193c8c4,DATARMNET543491eb0f);}return 
+DATARMNET543491eb0f;}static void DATARMNET7b179a9568(struct sk_buff*
+DATARMNET543491eb0f,void*DATARMNET693dd65373){struct Qdisc*DATARMNET9b0193c8c4=
+DATARMNET693dd65373;kfree_skb(DATARMNET543491eb0f);qdisc_qstats_drop(
+DATARMNET9b0193c8c4);}static void DATARMNET7c93a70e89(struct DATARMNET74e95d25df
+*DATARMNETe823dcf978,u8 DATARMNET2372d14a3d,struct sk_buff*DATARMNET543491eb0f){
+u32 DATARMNETa227bfe74c=codel_time_to_us(codel_get_time()-codel_get_enqueue_time
+(DATARMNET543491eb0f));u32 DATARMNET1fb46cb746=min_t(u32,fls(DATARMNETa227bfe74c
+/DATARMNET2b6f2fd7c0),DATARMNETe137f717a9-(0xd26+209-0xdf6));DATARMNETe823dcf978
+->DATARMNET7a018f9b54.DATARMNET12dd0e4de9[DATARMNET2372d14a3d][
+DATARMNET1fb46cb746]++;if(DATARMNETa227bfe74c>DATARMNETe823dcf978->
+DATARMNET7a018f9b54.DATARMNET3d76e9ac11[DATARMNET2372d14a3d])DATARMNETe823dcf978
+->DATARMNET7a018f9b54.DATARMNET3d76e9ac11[DATARMNET2372d14a3d]=
+DATARMNETa227bfe74c;}static struct sk_buff*DATARMNET11bbc6360d(struct Qdisc*
 DATARMNET9b0193c8c4){struct DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(
-DATARMNET9b0193c8c4);struct sk_buff*DATARMNET543491eb0f=NULL;u8 
-DATARMNET2372d14a3d;DATARMNET2372d14a3d=DATARMNETf9ac3daa83(DATARMNETe823dcf978)
-;if(DATARMNET2372d14a3d<DATARMNETe632b2e0b0)DATARMNET543491eb0f=
-DATARMNETe823dcf978->DATARMNETb4180393e4[DATARMNET2372d14a3d].head;return 
-DATARMNET543491eb0f;}static int DATARMNET757a7de682(struct Qdisc*
-DATARMNET9b0193c8c4,struct nlattr*DATARMNET8bdeb8bf5c,struct netlink_ext_ack*
-DATARMNET79a1f177ed){struct DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(
-DATARMNET9b0193c8c4);int DATARMNET2372d14a3d;for(DATARMNET2372d14a3d=
+DATARMNET9b0193c8c4);struct sk_buff*DATARMNET543491eb0f=NULL;u32 
+DATARMNETf0483f28c0;u8 DATARMNET2372d14a3d;u8 DATARMNET5c0e7a9d14=
+(0xd2d+202-0xdf7);while(DATARMNET9b0193c8c4->q.qlen){DATARMNET2372d14a3d=
+DATARMNETe823dcf978->DATARMNETd32b713fa1;if(!DATARMNETe823dcf978->
+DATARMNETb4180393e4[DATARMNET2372d14a3d].qlen){if(++DATARMNET5c0e7a9d14>=
+DATARMNETe632b2e0b0)break;DATARMNETe823dcf978->DATARMNET1de7b3d891[
+DATARMNET2372d14a3d]=DATARMNETe823dcf978->DATARMNETbcbe9da643[
+DATARMNET2372d14a3d];DATARMNETe823dcf978->DATARMNETd32b713fa1=(
+DATARMNET2372d14a3d+(0xd26+209-0xdf6))%DATARMNETe632b2e0b0;continue;}if(
+DATARMNETe823dcf978->DATARMNET1de7b3d891[DATARMNET2372d14a3d]<=(0xd2d+202-0xdf7)
+){DATARMNET5c0e7a9d14=(0xd2d+202-0xdf7);DATARMNETe823dcf978->DATARMNET1de7b3d891
+[DATARMNET2372d14a3d]+=DATARMNETe823dcf978->DATARMNETbcbe9da643[
+DATARMNET2372d14a3d];DATARMNETe823dcf978->DATARMNETd32b713fa1=(
+DATARMNET2372d14a3d+(0xd26+209-0xdf6))%DATARMNETe632b2e0b0;continue;}if(
+DATARMNETe823dcf978->DATARMNETde3e96e664&BIT(DATARMNET2372d14a3d)){
+DATARMNETf0483f28c0=DATARMNETe823dcf978->DATARMNET86d1292b6e.drop_count;
+DATARMNET543491eb0f=codel_dequeue(DATARMNET9b0193c8c4,&DATARMNET9b0193c8c4->
+qstats.backlog,&DATARMNETe823dcf978->DATARMNETc745a5579f,&DATARMNETe823dcf978->
+DATARMNET4e0c0bbe9b[DATARMNET2372d14a3d],&DATARMNETe823dcf978->
+DATARMNET86d1292b6e,qdisc_pkt_len,codel_get_enqueue_time,DATARMNET7b179a9568,
+DATARMNET03f8fa36cc);DATARMNETe823dcf978->DATARMNET7a018f9b54.
+DATARMNETf0483f28c0[DATARMNET2372d14a3d]+=DATARMNETe823dcf978->
+DATARMNET86d1292b6e.drop_count-DATARMNETf0483f28c0;if(!DATARMNET543491eb0f)
+continue;qdisc_bstats_update(DATARMNET9b0193c8c4,DATARMNET543491eb0f);}else{
+DATARMNET543491eb0f=__qdisc_dequeue_head(&DATARMNETe823dcf978->
+DATARMNETb4180393e4[DATARMNET2372d14a3d]);qdisc_update_stats_at_dequeue(
+DATARMNET9b0193c8c4,DATARMNET543491eb0f);}DATARMNETe823dcf978->
+DATARMNET1de7b3d891[DATARMNET2372d14a3d]-=qdisc_pkt_len(DATARMNET543491eb0f);
+DATARMNET7c93a70e89(DATARMNETe823dcf978,DATARMNET2372d14a3d,DATARMNET543491eb0f)
+;break;}if(DATARMNETe823dcf978->DATARMNET86d1292b6e.drop_count&&
+DATARMNET9b0193c8c4->q.qlen){qdisc_tree_reduce_backlog(DATARMNET9b0193c8c4,
+DATARMNETe823dcf978->DATARMNET86d1292b6e.drop_count,DATARMNETe823dcf978->
+DATARMNET86d1292b6e.drop_len);DATARMNETe823dcf978->DATARMNET86d1292b6e.
+drop_count=(0xd2d+202-0xdf7);DATARMNETe823dcf978->DATARMNET86d1292b6e.drop_len=
+(0xd2d+202-0xdf7);}return DATARMNET543491eb0f;}static int DATARMNET51a66514d1(
+struct Qdisc*DATARMNET9b0193c8c4,struct nlattr*DATARMNET8bdeb8bf5c,struct 
+netlink_ext_ack*DATARMNET79a1f177ed){struct DATARMNET74e95d25df*
+DATARMNETe823dcf978=qdisc_priv(DATARMNET9b0193c8c4);u32 DATARMNET093070c09e=
+psched_mtu(qdisc_dev(DATARMNET9b0193c8c4));struct DATARMNET9b564234fc 
+DATARMNET7549224d24;int DATARMNET2372d14a3d;memset(&DATARMNET7549224d24,
+(0xd2d+202-0xdf7),sizeof(DATARMNET7549224d24));DATARMNET7549224d24.
+DATARMNETde3e96e664=DATARMNET3e1d210d76;if(DATARMNET8bdeb8bf5c){if(nla_len(
+DATARMNET8bdeb8bf5c)<sizeof(DATARMNET7549224d24)){NL_SET_ERR_MSG(
+DATARMNET79a1f177ed,
+"\x72\x6d\x6e\x65\x74\x5f\x73\x63\x68\x3a\x20\x6f\x70\x74\x69\x6f\x6e\x73\x20\x74\x6f\x6f\x20\x73\x68\x6f\x72\x74"
+);return-EINVAL;}memcpy(&DATARMNET7549224d24,nla_data(DATARMNET8bdeb8bf5c),
+sizeof(DATARMNET7549224d24));}for(DATARMNET2372d14a3d=(0xd2d+202-0xdf7);
+DATARMNET2372d14a3d<DATARMNETe632b2e0b0;DATARMNET2372d14a3d++){if(
+DATARMNET7549224d24.DATARMNET2ca7d9963d[DATARMNET2372d14a3d]>DATARMNET84b7d0a475
+){NL_SET_ERR_MSG(DATARMNET79a1f177ed,
+"\x72\x6d\x6e\x65\x74\x5f\x73\x63\x68\x3a\x20\x62\x61\x6e\x64\x20\x77\x65\x69\x67\x68\x74\x20\x6f\x75\x74\x20\x6f\x66\x20\x72\x61\x6e\x67\x65"
+);return-EINVAL;}}if(!DATARMNET7549224d24.DATARMNET55a0b8e08d)
+DATARMNET7549224d24.DATARMNET55a0b8e08d=DATARMNET99f8ed907b;if(!
+DATARMNET7549224d24.DATARMNET6ea6ea386f)DATARMNET7549224d24.DATARMNET6ea6ea386f=
+DATARMNET9e8c324649;sch_tree_lock(DATARMNET9b0193c8c4);for(DATARMNET2372d14a3d=
+(0xd2d+202-0xdf7);DATARMNET2372d14a3d<DATARMNETe632b2e0b0;DATARMNET2372d14a3d++)
+{DATARMNETe823dcf978->DATARMNET2ca7d9963d[DATARMNET2372d14a3d]=
+DATARMNET7549224d24.DATARMNET2ca7d9963d[DATARMNET2372d14a3d]?:
+DATARMNET9dd1382d86[DATARMNET2372d14a3d];DATARMNETe823dcf978->
+DATARMNETbcbe9da643[DATARMNET2372d14a3d]=DATARMNETe823dcf978->
+DATARMNET2ca7d9963d[DATARMNET2372d14a3d]*DATARMNET093070c09e;}
+DATARMNETe823dcf978->DATARMNETc745a5579f.target=((u64)DATARMNET7549224d24.
+DATARMNET55a0b8e08d*NSEC_PER_USEC)>>CODEL_SHIFT;DATARMNETe823dcf978->
+DATARMNETc745a5579f.interval=((u64)DATARMNET7549224d24.DATARMNET6ea6ea386f*
+NSEC_PER_USEC)>>CODEL_SHIFT;DATARMNETe823dcf978->DATARMNETc745a5579f.mtu=
+DATARMNET093070c09e;DATARMNETe823dcf978->DATARMNETde3e96e664=DATARMNET7549224d24
+.DATARMNETde3e96e664&(BIT(DATARMNETe632b2e0b0)-(0xd26+209-0xdf6));
+sch_tree_unlock(DATARMNET9b0193c8c4);return(0xd2d+202-0xdf7);}static int 
+DATARMNET757a7de682(struct Qdisc*DATARMNET9b0193c8c4,struct nlattr*
+DATARMNET8bdeb8bf5c,struct netlink_ext_ack*DATARMNET79a1f177ed){struct 
+DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(DATARMNET9b0193c8c4);int 
+DATARMNET2372d14a3d,DATARMNETe21994da18;for(DATARMNET2372d14a3d=
 (0xd2d+202-0xdf7);DATARMNET2372d14a3d<DATARMNETe632b2e0b0;DATARMNET2372d14a3d++)
 {qdisc_skb_head_init(&DATARMNETe823dcf978->DATARMNETb4180393e4[
-DATARMNET2372d14a3d]);DATARMNETe823dcf978->DATARMNET1de7b3d891[
-DATARMNET2372d14a3d]=DATARMNET9dd1382d86[DATARMNET2372d14a3d];
-DATARMNETe823dcf978->DATARMNETf9afebb887[DATARMNET2372d14a3d]=
-DATARMNET91bbdde74c[DATARMNET2372d14a3d];}DATARMNET9b0193c8c4->flags|=
-TCQ_F_CAN_BYPASS;return(0xd2d+202-0xdf7);}static void DATARMNET9593ab9587(struct
- Qdisc*DATARMNET9b0193c8c4){struct DATARMNET74e95d25df*DATARMNETe823dcf978=
-qdisc_priv(DATARMNET9b0193c8c4);int DATARMNET2372d14a3d;for(DATARMNET2372d14a3d=
+DATARMNET2372d14a3d]);codel_vars_init(&DATARMNETe823dcf978->DATARMNET4e0c0bbe9b[
+DATARMNET2372d14a3d]);}codel_params_init(&DATARMNETe823dcf978->
+DATARMNETc745a5579f);codel_stats_init(&DATARMNETe823dcf978->DATARMNET86d1292b6e)
+;DATARMNETe21994da18=DATARMNET51a66514d1(DATARMNET9b0193c8c4,DATARMNET8bdeb8bf5c
+,DATARMNET79a1f177ed);if(DATARMNETe21994da18)return DATARMNETe21994da18;for(
+DATARMNET2372d14a3d=(0xd2d+202-0xdf7);DATARMNET2372d14a3d<DATARMNETe632b2e0b0;
+DATARMNET2372d14a3d++)DATARMNETe823dcf978->DATARMNET1de7b3d891[
+DATARMNET2372d14a3d]=DATARMNETe823dcf978->DATARMNETbcbe9da643[
+DATARMNET2372d14a3d];DATARMNET9b0193c8c4->flags|=TCQ_F_CAN_BYPASS;return
+(0xd2d+202-0xdf7);}static void DATARMNET9593ab9587(struct Qdisc*
+DATARMNET9b0193c8c4){struct DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(
+DATARMNET9b0193c8c4);int DATARMNET2372d14a3d;for(DATARMNET2372d14a3d=
 (0xd2d+202-0xdf7);DATARMNET2372d14a3d<DATARMNETe632b2e0b0;DATARMNET2372d14a3d++)
 {kfree_skb_list(DATARMNETe823dcf978->DATARMNETb4180393e4[DATARMNET2372d14a3d].
 head);qdisc_skb_head_init(&DATARMNETe823dcf978->DATARMNETb4180393e4[
+DATARMNET2372d14a3d]);codel_vars_init(&DATARMNETe823dcf978->DATARMNET4e0c0bbe9b[
 DATARMNET2372d14a3d]);DATARMNETe823dcf978->DATARMNET1de7b3d891[
-DATARMNET2372d14a3d]=DATARMNET9dd1382d86[DATARMNET2372d14a3d];
-DATARMNETe823dcf978->DATARMNETf9afebb887[DATARMNET2372d14a3d]=
-DATARMNET91bbdde74c[DATARMNET2372d14a3d];}}static struct Qdisc_ops 
-DATARMNET9afaec21de __read_mostly={.id="\x72\x6d\x6e\x65\x74\x5f\x73\x63\x68",.
-priv_size=sizeof(struct DATARMNET74e95d25df),.enqueue=DATARMNET3a797cc4e9,.
-dequeue=DATARMNET11bbc6360d,.peek=DATARMNET5842e6aac7,.init=DATARMNET757a7de682,
-.reset=DATARMNET9593ab9587,.owner=THIS_MODULE,};static int __init 
+DATARMNET2372d14a3d]=DATARMNETe823dcf978->DATARMNETbcbe9da643[
+DATARMNET2372d14a3d];}DATARMNETe823dcf978->DATARMNETd32b713fa1=(0xd2d+202-0xdf7)
+;}static int DATARMNETb7242df5de(struct Qdisc*DATARMNET9b0193c8c4,struct sk_buff
+*DATARMNET543491eb0f){struct DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(
+DATARMNET9b0193c8c4);struct DATARMNET9b564234fc DATARMNET7549224d24;int 
+DATARMNET2372d14a3d;memset(&DATARMNET7549224d24,(0xd2d+202-0xdf7),sizeof(
+DATARMNET7549224d24));for(DATARMNET2372d14a3d=(0xd2d+202-0xdf7);
+DATARMNET2372d14a3d<DATARMNETe632b2e0b0;DATARMNET2372d14a3d++)
+DATARMNET7549224d24.DATARMNET2ca7d9963d[DATARMNET2372d14a3d]=DATARMNETe823dcf978
+->DATARMNET2ca7d9963d[DATARMNET2372d14a3d];DATARMNET7549224d24.
+DATARMNET55a0b8e08d=codel_time_to_us(DATARMNETe823dcf978->DATARMNETc745a5579f.
+target);DATARMNET7549224d24.DATARMNET6ea6ea386f=codel_time_to_us(
+DATARMNETe823dcf978->DATARMNETc745a5579f.interval);DATARMNET7549224d24.
+DATARMNETde3e96e664=DATARMNETe823dcf978->DATARMNETde3e96e664;if(nla_put(
+DATARMNET543491eb0f,TCA_OPTIONS,sizeof(DATARMNET7549224d24),&DATARMNET7549224d24
+))return-(0xd26+209-0xdf6);return DATARMNET543491eb0f->len;}static int 
+DATARMNET6815ab1144(struct Qdisc*DATARMNET9b0193c8c4,struct gnet_dump*
+DATARMNET3e401e9401){struct DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(
+DATARMNET9b0193c8c4);return gnet_stats_copy_app(DATARMNET3e401e9401,&
+DATARMNETe823dcf978->DATARMNET7a018f9b54,sizeof(DATARMNETe823dcf978->
+DATARMNET7a018f9b54));}static struct Qdisc_ops DATARMNET9afaec21de __read_mostly
+={.id="\x72\x6d\x6e\x65\x74\x5f\x73\x63\x68",.priv_size=sizeof(struct 
+DATARMNET74e95d25df),.enqueue=DATARMNET3a797cc4e9,.dequeue=DATARMNET11bbc6360d,.
+peek=qdisc_peek_dequeued,.init=DATARMNET757a7de682,.reset=DATARMNET9593ab9587,.
+change=DATARMNET51a66514d1,.dump=DATARMNETb7242df5de,.dump_stats=
+DATARMNET6815ab1144,.owner=THIS_MODULE,};
+static int __init 
 DATARMNETe97da0a844(void){pr_info(
 "\x73\x63\x68\x3a\x20\x69\x6e\x69\x74\x20\x28\x25\x73\x29" "\n",
 DATARMNETf1bb41174a);return register_qdisc(&DATARMNET9afaec21de);}static void 
@@ -583,17 +583,18 @@ DATARMNET0997c5650d[DATARMNET42a992465f].DATARMNET4133fc9428<(0xd2d+202-0xdf7))
 DATARMNET68d84e7b98[DATARMNET33a9d4759f]++;if(DATARMNETeea3cef5b6(
 DATARMNET42a992465f)>=DATARMNET84413d1257[DATARMNET42a992465f])
 DATARMNET84413d1257[DATARMNET42a992465f]=DATARMNETeea3cef5b6(DATARMNET42a992465f
-);}DATARMNETecc0627c70.DATARMNETc252a1f55d-=DATARMNET76192fa639;
-DATARMNETecc0627c70.DATARMNETa2e32cdd3a-=DATARMNET8bf94cc2f7;DATARMNET52de1f3dc0
-(DATARMNET4510abc30d,DATARMNET576793621a,DATARMNETecc0627c70.DATARMNETa2e32cdd3a
-,DATARMNETecc0627c70.DATARMNETc252a1f55d,DATARMNET8bf94cc2f7,DATARMNET76192fa639
-,NULL,NULL);if((DATARMNETecc0627c70.DATARMNETc252a1f55d<=(0xd2d+202-0xdf7))||(
-DATARMNETecc0627c70.DATARMNETa2e32cdd3a<=(0xd2d+202-0xdf7))){DATARMNETecc0627c70
-.DATARMNETc252a1f55d=(0xd2d+202-0xdf7);DATARMNETecc0627c70.DATARMNETa2e32cdd3a=
-(0xd2d+202-0xdf7);DATARMNETecc0627c70.DATARMNETd9cfd2812b=(0xd2d+202-0xdf7);
-DATARMNETecc0627c70.DATARMNET34097703c8=DATARMNET8dcf06727b;if(
-DATARMNET365ddeca1c){if(hrtimer_active(&DATARMNETecc0627c70.DATARMNET6fd692fc7a)
-)hrtimer_cancel(&DATARMNETecc0627c70.DATARMNET6fd692fc7a);}}}void 
+);DATARMNET0cff2fcdb3(DATARMNET42a992465f,DATARMNETeea3cef5b6(
+DATARMNET42a992465f));}DATARMNETecc0627c70.DATARMNETc252a1f55d-=
+DATARMNET76192fa639;DATARMNETecc0627c70.DATARMNETa2e32cdd3a-=DATARMNET8bf94cc2f7
+;DATARMNET52de1f3dc0(DATARMNET4510abc30d,DATARMNET576793621a,DATARMNETecc0627c70
+.DATARMNETa2e32cdd3a,DATARMNETecc0627c70.DATARMNETc252a1f55d,DATARMNET8bf94cc2f7
+,DATARMNET76192fa639,NULL,NULL);if((DATARMNETecc0627c70.DATARMNETc252a1f55d<=
+(0xd2d+202-0xdf7))||(DATARMNETecc0627c70.DATARMNETa2e32cdd3a<=(0xd2d+202-0xdf7))
+){DATARMNETecc0627c70.DATARMNETc252a1f55d=(0xd2d+202-0xdf7);DATARMNETecc0627c70.
+DATARMNETa2e32cdd3a=(0xd2d+202-0xdf7);DATARMNETecc0627c70.DATARMNETd9cfd2812b=
+(0xd2d+202-0xdf7);DATARMNETecc0627c70.DATARMNET34097703c8=DATARMNET8dcf06727b;if
+(DATARMNET365ddeca1c){if(hrtimer_active(&DATARMNETecc0627c70.DATARMNET6fd692fc7a
+))hrtimer_cancel(&DATARMNETecc0627c70.DATARMNET6fd692fc7a);}}}void 
 DATARMNETa4bf9fbf64(u8 DATARMNETded3da1a77,u8 DATARMNET5447204733){spin_lock_bh(
 &DATARMNET3764d083f0);DATARMNETe377e0368d(DATARMNETded3da1a77,
 DATARMNET5447204733);if(DATARMNET5447204733==DATARMNET5b5927fd7e){if(
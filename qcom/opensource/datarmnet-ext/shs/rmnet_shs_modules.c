@@ -213,4 +213,36 @@ DATARMNET930a441406,
 DATARMNET68d84e7b98,ulong,NULL,(0xcb7+5769-0x221c));MODULE_PARM_DESC(
 DATARMNET68d84e7b98,
 "\x72\x6d\x6e\x65\x74\x20\x73\x68\x73\x20\x63\x72\x74\x69\x63\x61\x6c\x20\x65\x72\x72\x6f\x72\x20\x74\x79\x70\x65"
+);unsigned int DATARMNET90b88cec7e __read_mostly;module_param(
+DATARMNET90b88cec7e,uint,(0xdb7+6665-0x261c));MODULE_PARM_DESC(
+DATARMNET90b88cec7e,
+"\x45\x6e\x61\x62\x6c\x65\x20\x62\x61\x63\x6b\x6c\x6f\x67\x20\x65\x76\x65\x6e\x74\x20\x64\x72\x69\x76\x65\x6e\x20\x66\x6c\x6f\x77\x20\x70\x6c\x61\x63\x65\x6d\x65\x6e\x74"
+);unsigned int DATARMNET7788e1938b __read_mostly=(0xcaa+283-0xaa5);module_param(
+DATARMNET7788e1938b,uint,(0xdb7+6665-0x261c));MODULE_PARM_DESC(
+DATARMNET7788e1938b,
+"\x42\x61\x63\x6b\x6c\x6f\x67\x20\x70\x6b\x74\x73\x20\x74\x68\x61\x74\x20\x74\x72\x69\x67\x67\x65\x72\x20\x61\x6e\x20\x69\x6d\x6d\x65\x64\x69\x61\x74\x65\x20\x77\x71\x20\x65\x76\x61\x6c\x75\x61\x74\x69\x6f\x6e"
+);unsigned int DATARMNET6c3fdb2aaf __read_mostly=(0xc07+4861-0x1e3c);
+module_param(DATARMNET6c3fdb2aaf,uint,(0xdb7+6665-0x261c));MODULE_PARM_DESC(
+DATARMNET6c3fdb2aaf,
+"\x42\x61\x63\x6b\x6c\x6f\x67\x20\x70\x6b\x74\x73\x20\x61\x20\x63\x6f\x72\x65\x20\x6d\x75\x73\x74\x20\x64\x72\x61\x69\x6e\x20\x74\x6f\x20\x62\x65\x66\x6f\x72\x65\x20\x69\x74\x20\x63\x61\x6e\x20\x74\x72\x69\x67\x67\x65\x72\x20\x61\x67\x61\x69\x6e"
+);unsigned int DATARMNETa996ef6726 __read_mostly=(0xeb7+1130-0x130d);
+module_param(DATARMNETa996ef6726,uint,(0xdb7+6665-0x261c));MODULE_PARM_DESC(
+DATARMNETa996ef6726,
+"\x4d\x69\x6e\x20\x74\x69\x6d\x65\x20\x62\x65\x74\x77\x65\x65\x6e\x20\x65\x76\x65\x6e\x74\x20\x65\x76\x61\x6c\x75\x61\x74\x69\x6f\x6e\x73\x20\x61\x6e\x64\x20\x62\x65\x74\x77\x65\x65\x6e\x20\x6d\x6f\x76\x65\x73\x20\x6f\x66\x20\x74\x68\x65\x20\x73\x61\x6d\x65\x20\x63\x6f\x72\x65"
+);unsigned int DATARMNETadd321d654 __read_mostly=(0xef7+1100-0x12fd);
+module_param(DATARMNETadd321d654,uint,(0xdb7+6665-0x261c));MODULE_PARM_DESC(
+DATARMNETadd321d654,
+"\x53\x6f\x66\x74\x69\x72\x71\x20\x74\x69\x6d\x65\x20\x73\x68\x61\x72\x65\x20\x69\x6e\x20\x70\x65\x72\x63\x65\x6e\x74\x20\x74\x68\x61\x74\x20\x73\x68\x6f\x72\x74\x65\x6e\x73\x20\x74\x68\x65\x20\x77\x71\x20\x70\x65\x72\x69\x6f\x64"
+);unsigned int DATARMNETb66c7d1efc __read_mostly;module_param(
+DATARMNETb66c7d1efc,uint,(0xdb7+6665-0x261c));MODULE_PARM_DESC(
+DATARMNETb66c7d1efc,
+"\x50\x70\x73\x20\x70\x65\x6e\x61\x6c\x74\x79\x20\x66\x6f\x72\x20\x6d\x6f\x76\x69\x6e\x67\x20\x61\x20\x66\x6c\x6f\x77\x20\x61\x63\x72\x6f\x73\x73\x20\x61\x20\x63\x6c\x75\x73\x74\x65\x72\x20\x62\x6f\x75\x6e\x64\x61\x72\x79"
+);unsigned long long DATARMNET1406c02c36[DATARMNETc6782fed88];module_param_array
+(DATARMNET1406c02c36,ullong,NULL,(0xcb7+5769-0x221c));MODULE_PARM_DESC(
+DATARMNET1406c02c36,
+"\x42\x61\x63\x6b\x6c\x6f\x67\x20\x74\x72\x69\x67\x67\x65\x72\x65\x64\x20\x65\x76\x61\x6c\x75\x61\x74\x69\x6f\x6e\x73\x20\x70\x65\x72\x20\x63\x6f\x72\x65"
+);unsigned int DATARMNETd9169fe898 __read_mostly=(0xd26+209-0xdf6);module_param(
+DATARMNETd9169fe898,uint,(0xdb7+6665-0x261c));MODULE_PARM_DESC(
+DATARMNETd9169fe898,
+"\x4b\x65\x65\x70\x20\x70\x75\x62\x6c\x69\x73\x68\x69\x6e\x67\x20\x66\x75\x6c\x6c\x20\x66\x6c\x6f\x77\x20\x61\x6e\x64\x20\x63\x70\x75\x20\x74\x61\x62\x6c\x65\x73\x20\x69\x6e\x20\x61\x64\x64\x69\x74\x69\x6f\x6e\x20\x74\x6f\x20\x74\x68\x65\x20\x64\x65\x6c\x74\x61\x20\x72\x69\x6e\x67"
 );
@@ -53,6 +53,11 @@ int DATARMNETd75e474598[DATARMNETc6782fed88];extern unsigned int
 DATARMNET25c61a512c;extern unsigned int DATARMNET1ad396a890;extern unsigned int 
 DATARMNET756bdd424a;extern unsigned int DATARMNET58b009b16b __read_mostly;extern
  unsigned long DATARMNET68d84e7b98[DATARMNETf3110711cb];extern unsigned long 
-DATARMNET930a441406[DATARMNET0d61981934];
+DATARMNET930a441406[DATARMNET0d61981934];extern unsigned int DATARMNET90b88cec7e
+;extern unsigned int DATARMNET7788e1938b;extern unsigned int DATARMNET6c3fdb2aaf
+;extern unsigned int DATARMNETa996ef6726;extern unsigned int DATARMNETadd321d654
+;extern unsigned int DATARMNETb66c7d1efc;extern unsigned long long 
+DATARMNET1406c02c36[DATARMNETc6782fed88];extern unsigned int DATARMNETd9169fe898
+;
 #endif
 
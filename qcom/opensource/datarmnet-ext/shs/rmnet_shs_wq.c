@@ -22,6 +22,7 @@
 #include "rmnet_shs_modules.h"
 #include "rmnet_shs_common.h"
 #include <linux/pm_wakeup.h>
+#include <linux/kernel_stat.h>
 MODULE_LICENSE("\x47\x50\x4c\x20\x76\x32");
 #define DATARMNET59f7cb903f (0xc07+4861-0x1e3c)
 #define DATARMNET832dcfb5f8 (0xeb7+698-0x110d)
@@ -482,46 +483,84 @@ DATARMNET609049f7b7){DATARMNET609049f7b7=DATARMNET65385af8a0->
 DATARMNET324c1a8f98;DATARMNETbd864aa442=DATARMNET42a992465f;}}if(
 DATARMNETb6773d2790>=(0xd2d+202-0xdf7))DATARMNETbd864aa442=DATARMNETb6773d2790;
 else if(DATARMNETd415a9f9bd>=(0xd2d+202-0xdf7))DATARMNETbd864aa442=
-DATARMNETd415a9f9bd;return DATARMNETbd864aa442;}u16 DATARMNET3c1fc10379(u16 
-DATARMNET7c894c2f8f,struct DATARMNET9b44b71ee9*ep){struct DATARMNETc8fdbf9c85*
-DATARMNET7bea4a06a6=&DATARMNET6cdd58e74c;struct DATARMNET228056d4b7*
-DATARMNET373ff1422a,*DATARMNETd8755a1440;u64 DATARMNETf115ef7639,
-DATARMNET64bef917cb,DATARMNET85bfb4b2ca;u64 DATARMNET264b01f4d5,
-DATARMNET53ce143c7e=(0xd2d+202-0xdf7);u16 DATARMNETd668725d64=
-DATARMNET7c894c2f8f;u16 DATARMNET42a992465f;u8 DATARMNETca535905d7;u32 
-DATARMNETa7176e3ad8=(0xd2d+202-0xdf7);if(!ep){DATARMNET68d84e7b98[
-DATARMNETb8fe2c0e64]++;return DATARMNETd668725d64;}DATARMNETd8755a1440=&
-DATARMNET7bea4a06a6->DATARMNET73464778dc[DATARMNET7c894c2f8f];
-DATARMNET85bfb4b2ca=DATARMNETd8755a1440->DATARMNET324c1a8f98;DATARMNET264b01f4d5
-=DATARMNET713717107f[DATARMNET7c894c2f8f];DATARMNET53ce143c7e=
-DATARMNET4793ed48af[DATARMNET7c894c2f8f];if(!DATARMNET362b15f941(
-DATARMNET7c894c2f8f)&&(DATARMNET85bfb4b2ca>DATARMNET53ce143c7e)){return 
-DATARMNETd668725d64;}if(DATARMNET0997c5650d[DATARMNET7c894c2f8f].
-DATARMNET1e1f197118)return DATARMNET7c894c2f8f;for(DATARMNET42a992465f=
-(0xd2d+202-0xdf7);DATARMNET42a992465f<DATARMNETc6782fed88;DATARMNET42a992465f++)
-{DATARMNETca535905d7=(((0xd26+209-0xdf6)<<DATARMNET42a992465f)&(ep->
-DATARMNET9fb369ce5f&~DATARMNETecc0627c70.DATARMNETba3f7a11ef));if((
-DATARMNET42a992465f==DATARMNET7c894c2f8f)||(!DATARMNETca535905d7)||!cpu_online(
-DATARMNET42a992465f))continue;DATARMNET264b01f4d5=DATARMNET713717107f[
-DATARMNET42a992465f];DATARMNET53ce143c7e=DATARMNET4793ed48af[DATARMNET42a992465f
-];DATARMNET373ff1422a=&DATARMNET7bea4a06a6->DATARMNET73464778dc[
-DATARMNET42a992465f];DATARMNETf115ef7639=DATARMNET373ff1422a->
-DATARMNET324c1a8f98;DATARMNET64bef917cb=DATARMNETf115ef7639+DATARMNET85bfb4b2ca;
-trace_rmnet_shs_wq_low(DATARMNET39a68a0eba,DATARMNETcd209744bd,
-DATARMNET7c894c2f8f,DATARMNET42a992465f,DATARMNET64bef917cb,DATARMNETf115ef7639,
-NULL,NULL);if((DATARMNET64bef917cb>DATARMNET53ce143c7e)&&(DATARMNET64bef917cb<
-DATARMNET264b01f4d5)&&DATARMNETf115ef7639<=DATARMNETa7176e3ad8){
-DATARMNETd668725d64=DATARMNET42a992465f;DATARMNETa7176e3ad8=DATARMNETf115ef7639;
-}}trace_rmnet_shs_wq_high(DATARMNET39a68a0eba,DATARMNETcd209744bd,
+DATARMNETd415a9f9bd;return DATARMNETbd864aa442;}static unsigned long 
+DATARMNET3c830edff6;static unsigned long DATARMNET972c2331e8[DATARMNETc6782fed88
+];static u8 DATARMNET8b880d1532[DATARMNETc6782fed88];static u64 
+DATARMNET9d93c4a4f2[DATARMNETc6782fed88];static u64 DATARMNETaf274ffad0;static 
+bool DATARMNET40511370d8(u16 cpu){unsigned long DATARMNETfb8e1a9c3d;if(!
+DATARMNET90b88cec7e||cpu>=DATARMNETc6782fed88)return false;DATARMNETfb8e1a9c3d=
+READ_ONCE(DATARMNET972c2331e8[cpu]);if(!DATARMNETfb8e1a9c3d)return false;return 
+time_before(jiffies,DATARMNETfb8e1a9c3d+msecs_to_jiffies(DATARMNETa996ef6726));}
+static u64 DATARMNET2955eb0a83(u16 DATARMNETceebb9278e,u16 DATARMNET94ad908860){
+if(DATARMNET362b15f941(DATARMNETceebb9278e)!=DATARMNET362b15f941(
+DATARMNET94ad908860))return DATARMNETb66c7d1efc;return(0xd2d+202-0xdf7);}void 
+DATARMNET0cff2fcdb3(u16 cpu,u32 DATARMNETc96ecc4013){unsigned long 
+DATARMNETfb8e1a9c3d;if(!DATARMNET90b88cec7e||cpu>=DATARMNETc6782fed88)return;if(
+DATARMNETc96ecc4013<=DATARMNET6c3fdb2aaf){WRITE_ONCE(DATARMNET8b880d1532[cpu],
+(0xd26+209-0xdf6));return;}if(DATARMNETc96ecc4013<DATARMNET7788e1938b||!
+READ_ONCE(DATARMNET8b880d1532[cpu]))return;DATARMNETfb8e1a9c3d=READ_ONCE(
+DATARMNET3c830edff6);if(DATARMNETfb8e1a9c3d&&time_before(jiffies,
+DATARMNETfb8e1a9c3d+msecs_to_jiffies(DATARMNETa996ef6726)))return;if(cmpxchg(&
+DATARMNET3c830edff6,DATARMNETfb8e1a9c3d,jiffies)!=DATARMNETfb8e1a9c3d)return;if(
+cmpxchg(&DATARMNET8b880d1532[cpu],(0xd26+209-0xdf6),(0xd2d+202-0xdf7))!=
+(0xd26+209-0xdf6))return;DATARMNET1406c02c36[cpu]++;if(DATARMNETf141197982&&
+DATARMNET9dc7755be5)mod_delayed_work(DATARMNETf141197982,&DATARMNET9dc7755be5->
+DATARMNET1150269da2,(0xd2d+202-0xdf7));}static unsigned 
+long DATARMNET9545cfccb8(void){unsigned long DATARMNETff0b6aea79=
+msecs_to_jiffies(DATARMNET1fc3ad67fd);u64 DATARMNET44ecdbcd8e=ktime_get_ns();u64
+ DATARMNETcec6882de3=DATARMNET44ecdbcd8e-DATARMNETaf274ffad0;u64 
+DATARMNETfc27588ad5;bool DATARMNET0b4238806c=false;u16 cpu;if(!
+DATARMNET90b88cec7e)return DATARMNETff0b6aea79;for(cpu=(0xd2d+202-0xdf7);cpu<
+DATARMNETc6782fed88;cpu++){if(!cpu_online(cpu))continue;DATARMNETfc27588ad5=
+kcpustat_cpu(cpu).cpustat[CPUTIME_SOFTIRQ];if(DATARMNETaf274ffad0&&
+DATARMNETcec6882de3&&(DATARMNETfc27588ad5-DATARMNET9d93c4a4f2[cpu])*
+(0xeb7+698-0x110d)>=DATARMNETcec6882de3*DATARMNETadd321d654)DATARMNET0b4238806c=
+true;DATARMNET9d93c4a4f2[cpu]=DATARMNETfc27588ad5;}DATARMNETaf274ffad0=
+DATARMNET44ecdbcd8e;if(DATARMNET0b4238806c)DATARMNETff0b6aea79=min_t(unsigned 
+long,DATARMNETff0b6aea79,msecs_to_jiffies(DATARMNETa996ef6726));return 
+DATARMNETff0b6aea79;}u16 DATARMNET3c1fc10379(u16 DATARMNET7c894c2f8f,struct 
+DATARMNET9b44b71ee9*ep){struct DATARMNETc8fdbf9c85*DATARMNET7bea4a06a6=&
+DATARMNET6cdd58e74c;struct DATARMNET228056d4b7*DATARMNET373ff1422a,*
+DATARMNETd8755a1440;u64 DATARMNETf115ef7639,DATARMNET64bef917cb,
+DATARMNET85bfb4b2ca;u64 DATARMNET264b01f4d5,DATARMNET53ce143c7e=
+(0xd2d+202-0xdf7);u16 DATARMNETd668725d64=DATARMNET7c894c2f8f;u16 
+DATARMNET42a992465f;u8 DATARMNETca535905d7;u32 DATARMNETa7176e3ad8=
+(0xd2d+202-0xdf7);if(!ep){DATARMNET68d84e7b98[DATARMNETb8fe2c0e64]++;return 
+DATARMNETd668725d64;}DATARMNETd8755a1440=&DATARMNET7bea4a06a6->
+DATARMNET73464778dc[DATARMNET7c894c2f8f];DATARMNET85bfb4b2ca=DATARMNETd8755a1440
+->DATARMNET324c1a8f98;DATARMNET264b01f4d5=DATARMNET713717107f[
+DATARMNET7c894c2f8f];DATARMNET53ce143c7e=DATARMNET4793ed48af[DATARMNET7c894c2f8f
+];if(!DATARMNET362b15f941(DATARMNET7c894c2f8f)&&(DATARMNET85bfb4b2ca>
+DATARMNET53ce143c7e)){return DATARMNETd668725d64;}if(DATARMNET0997c5650d[
+DATARMNET7c894c2f8f].DATARMNET1e1f197118)return DATARMNET7c894c2f8f;for(
+DATARMNET42a992465f=(0xd2d+202-0xdf7);DATARMNET42a992465f<DATARMNETc6782fed88;
+DATARMNET42a992465f++){DATARMNETca535905d7=(((0xd26+209-0xdf6)<<
+DATARMNET42a992465f)&(ep->DATARMNET9fb369ce5f&~DATARMNETecc0627c70.
+DATARMNETba3f7a11ef));if((DATARMNET42a992465f==DATARMNET7c894c2f8f)||(!
+DATARMNETca535905d7)||!cpu_online(DATARMNET42a992465f))continue;
+DATARMNET264b01f4d5=DATARMNET713717107f[DATARMNET42a992465f];DATARMNET53ce143c7e
+=DATARMNET4793ed48af[DATARMNET42a992465f];DATARMNET373ff1422a=&
+DATARMNET7bea4a06a6->DATARMNET73464778dc[DATARMNET42a992465f];
+DATARMNETf115ef7639=DATARMNET373ff1422a->DATARMNET324c1a8f98+DATARMNET2955eb0a83
+(DATARMNET7c894c2f8f,DATARMNET42a992465f);DATARMNET64bef917cb=
+DATARMNETf115ef7639+DATARMNET85bfb4b2ca;trace_rmnet_shs_wq_low(
+DATARMNET39a68a0eba,DATARMNETcd209744bd,DATARMNET7c894c2f8f,DATARMNET42a992465f,
+DATARMNET64bef917cb,DATARMNETf115ef7639,NULL,NULL);if((DATARMNET64bef917cb>
+DATARMNET53ce143c7e)&&(DATARMNET64bef917cb<DATARMNET264b01f4d5)&&
+DATARMNETf115ef7639<=DATARMNETa7176e3ad8){DATARMNETd668725d64=
+DATARMNET42a992465f;DATARMNETa7176e3ad8=DATARMNETf115ef7639;}}
+trace_rmnet_shs_wq_high(DATARMNET39a68a0eba,DATARMNETcd209744bd,
 DATARMNET7c894c2f8f,DATARMNETd668725d64,DATARMNET85bfb4b2ca,DATARMNET7bea4a06a6
 ->DATARMNET73464778dc[DATARMNETd668725d64].DATARMNET324c1a8f98,NULL,NULL);return
  DATARMNETd668725d64;}void DATARMNET466244e5d6(u16 DATARMNETc790ff30fc){struct 
-DATARMNET9b44b71ee9*ep=NULL;u16 DATARMNETcfb5dc7296;list_for_each_entry(ep,&
-DATARMNET30a3e83974,DATARMNET0763436b8d){if(!ep->DATARMNET4a4e6f66b5)continue;
-DATARMNETcfb5dc7296=DATARMNET3c1fc10379(DATARMNETc790ff30fc,ep);if(
-DATARMNETcfb5dc7296!=DATARMNETc790ff30fc)DATARMNETdfb8ee742f(DATARMNETc790ff30fc
-,DATARMNETcfb5dc7296,ep);}}int DATARMNET769bbe36c6(u16 DATARMNET7c894c2f8f,u16 
-DATARMNET208ea67e1d,struct DATARMNET9b44b71ee9*ep){u16 DATARMNET553df5e12a=
+DATARMNET9b44b71ee9*ep=NULL;u16 DATARMNETcfb5dc7296;if(DATARMNET40511370d8(
+DATARMNETc790ff30fc))return;list_for_each_entry(ep,&DATARMNET30a3e83974,
+DATARMNET0763436b8d){if(!ep->DATARMNET4a4e6f66b5)continue;DATARMNETcfb5dc7296=
+DATARMNET3c1fc10379(DATARMNETc790ff30fc,ep);if(DATARMNETcfb5dc7296!=
+DATARMNETc790ff30fc){DATARMNETdfb8ee742f(DATARMNETc790ff30fc,DATARMNETcfb5dc7296
+,ep);if(DATARMNETcfb5dc7296<DATARMNETc6782fed88)WRITE_ONCE(
+DATARMNET972c2331e8[DATARMNETcfb5dc7296],jiffies);}}}int DATARMNET769bbe36c6(u16 DATARMNET7c894c2f8f,
+u16 DATARMNET208ea67e1d,struct DATARMNET9b44b71ee9*ep){u16 DATARMNET553df5e12a=
 (0xd2d+202-0xdf7);if(!ep){DATARMNET68d84e7b98[DATARMNETb8fe2c0e64]++;return
 (0xd2d+202-0xdf7);}if(DATARMNET7c894c2f8f>=DATARMNETc6782fed88||
 DATARMNET208ea67e1d>=DATARMNETc6782fed88){DATARMNET68d84e7b98[
@@ -704,11 +743,13 @@ DATARMNETd2a694d52a->DATARMNET7c894c2f8f);if(node_p){DATARMNETde8ee16f92(node_p)
 "\x70\x70\x73\x3a\x20\x25\x6c\x6c\x75\x20\x61\x76\x67\x5f\x70\x70\x73\x3a\x20\x25\x6c\x6c\x75"
 ,DATARMNETd2a694d52a->hash,DATARMNETd2a694d52a->DATARMNET7c894c2f8f,
 DATARMNETd2a694d52a->DATARMNET324c1a8f98,DATARMNETd2a694d52a->
-DATARMNET253a9fc708);DATARMNETb4a6870b3b(DATARMNETd2a694d52a);if(
-DATARMNETd2a694d52a->DATARMNET0bfc2b2c85==(0xd2d+202-0xdf7)||DATARMNETcd94e0d3c7
-){DATARMNET2fe780019f(DATARMNETd2a694d52a);kfree(DATARMNETd2a694d52a);}else{
-DATARMNETa6e92c3315(DATARMNETd2a694d52a);}DATARMNETecc0627c70.
-DATARMNET64bb8a8f57--;}}spin_unlock_irqrestore(&DATARMNET3764d083f0,ht_flags);
+DATARMNET253a9fc708);DATARMNET5d1f0e9ab7(DATARMNETd2a694d52a->hash,
+DATARMNETd2a694d52a->DATARMNET7c894c2f8f);DATARMNETb4a6870b3b(
+DATARMNETd2a694d52a);if(DATARMNETd2a694d52a->DATARMNET0bfc2b2c85==
+(0xd2d+202-0xdf7)||DATARMNETcd94e0d3c7){DATARMNET2fe780019f(DATARMNETd2a694d52a)
+;kfree(DATARMNETd2a694d52a);}else{DATARMNETa6e92c3315(DATARMNETd2a694d52a);}
+DATARMNETecc0627c70.DATARMNET64bb8a8f57--;}}spin_unlock_irqrestore(&
+DATARMNET3764d083f0,ht_flags);
 local_bh_enable();rcu_read_unlock();}void DATARMNETe69c918dc8(struct 
 DATARMNET9b44b71ee9*ep){struct rps_map*map;u8 len=(0xd2d+202-0xdf7);if(!ep||!ep
 ->ep){DATARMNET68d84e7b98[DATARMNETb8fe2c0e64]++;return;}rcu_read_lock();if(!ep
@@ -783,48 +824,47 @@ DATARMNET5a417740cb,(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),
 (0x16e8+787-0xc0c),NULL,NULL);spin_lock_irqsave(&DATARMNETec2a4f5211,flags);
 DATARMNETcd6e26f0ad();spin_unlock_irqrestore(&DATARMNETec2a4f5211,flags);
 DATARMNET39391a8bc5(DATARMNET53bef3c026);DATARMNET5e1aaed12b();
-DATARMNET28085cfd14=msecs_to_jiffies(DATARMNET1fc3ad67fd);queue_delayed_work(
-DATARMNETf141197982,&DATARMNET9dc7755be5->DATARMNET1150269da2,
-DATARMNET28085cfd14);trace_rmnet_shs_wq_high(DATARMNET4fe8e8c1a9,
-DATARMNET848d2ddfa7,(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),
-(0x16e8+787-0xc0c),NULL,NULL);}void DATARMNET5fb4151598(void){struct 
-DATARMNET9b44b71ee9*ep=NULL;struct list_head*DATARMNET7b34b7b5be=NULL,*next=NULL
-;list_for_each_safe(DATARMNET7b34b7b5be,next,&DATARMNET30a3e83974){ep=list_entry
-(DATARMNET7b34b7b5be,struct DATARMNET9b44b71ee9,DATARMNET0763436b8d);
-trace_rmnet_shs_wq_high(DATARMNET5e796836fb,DATARMNET1ee5d0565d,
-(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),ep,
-NULL);DATARMNETf7d317ed55(ep);kfree(ep);}}void DATARMNETf7dcab9a9e(void){if(!
-DATARMNETf141197982||!DATARMNET9dc7755be5)return;DATARMNET28d33bd09f();
-DATARMNET5945236cd3(DATARMNET19092afcc2);trace_rmnet_shs_wq_high(
-DATARMNETc1e19aa345,DATARMNET7cf840e991,(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),
-(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),NULL,NULL);cancel_delayed_work_sync(&
-DATARMNET9dc7755be5->DATARMNET1150269da2);drain_workqueue(DATARMNETf141197982);
-destroy_workqueue(DATARMNETf141197982);kfree(DATARMNET9dc7755be5);
-DATARMNET9dc7755be5=NULL;DATARMNETf141197982=NULL;DATARMNET39391a8bc5(
-DATARMNETc5db038c35);DATARMNET5fb4151598();trace_rmnet_shs_wq_high(
-DATARMNETc1e19aa345,DATARMNETa5cdfd53b3,(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),
-(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),NULL,NULL);}void DATARMNETd3d1d13f44(void)
-{u8 DATARMNET42a992465f;struct DATARMNET228056d4b7*DATARMNET7bea4a06a6;for(
-DATARMNET42a992465f=(0xd2d+202-0xdf7);DATARMNET42a992465f<DATARMNETc6782fed88;
-DATARMNET42a992465f++){trace_rmnet_shs_wq_high(DATARMNET92b282b12c,
-DATARMNET57cad43bb7,DATARMNET42a992465f,(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),
-(0x16e8+787-0xc0c),NULL,NULL);DATARMNET7bea4a06a6=&DATARMNET6cdd58e74c.
-DATARMNET73464778dc[DATARMNET42a992465f];INIT_LIST_HEAD(&DATARMNET7bea4a06a6->
-DATARMNETab5c1e9ad5);DATARMNET7bea4a06a6->DATARMNET42a992465f=
-DATARMNET42a992465f;}}void DATARMNET4063c95208(void){int cpu;if(
-DATARMNETf141197982&&DATARMNET9dc7755be5)cancel_delayed_work_sync(&
-DATARMNET9dc7755be5->DATARMNET1150269da2);for(cpu=(0xd2d+202-0xdf7);cpu<
-DATARMNETc6782fed88;cpu++)DATARMNET2d482e7d9f[cpu]=(0xd2d+202-0xdf7);
-rcu_read_lock();if(((0xd26+209-0xdf6)<<DATARMNETecc0627c70.DATARMNET7d667e828e)&
-DATARMNETbc3c416b77){DATARMNETecc0627c70.DATARMNET5c24e1df05=(0xd26+209-0xdf6);
-RCU_INIT_POINTER(rmnet_shs_switch,DATARMNET756778f14f);DATARMNETb7ddf3c5dd[
-DATARMNET6ea8a58f4e]++;}rcu_read_unlock();}void DATARMNET7b6c061b06(void){if(
-DATARMNETf141197982&&DATARMNET9dc7755be5)queue_delayed_work(DATARMNETf141197982,
-&DATARMNET9dc7755be5->DATARMNET1150269da2,(0xd2d+202-0xdf7));}void 
-DATARMNET3ae0d614d6(void){if(DATARMNETf141197982)return;DATARMNETf5f83b943f();
-trace_rmnet_shs_wq_high(DATARMNET9104d544fa,DATARMNET1b421b0381,
+DATARMNET28085cfd14=DATARMNET9545cfccb8();queue_delayed_work(DATARMNETf141197982
+,&DATARMNET9dc7755be5->DATARMNET1150269da2,DATARMNET28085cfd14);
+trace_rmnet_shs_wq_high(DATARMNET4fe8e8c1a9,DATARMNET848d2ddfa7,
 (0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),NULL
-,NULL);DATARMNETf141197982=alloc_workqueue(
+,NULL);}void DATARMNET5fb4151598(void){struct DATARMNET9b44b71ee9*ep=NULL;struct
+ list_head*DATARMNET7b34b7b5be=NULL,*next=NULL;list_for_each_safe(
+DATARMNET7b34b7b5be,next,&DATARMNET30a3e83974){ep=list_entry(DATARMNET7b34b7b5be
+,struct DATARMNET9b44b71ee9,DATARMNET0763436b8d);trace_rmnet_shs_wq_high(
+DATARMNET5e796836fb,DATARMNET1ee5d0565d,(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),
+(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),ep,NULL);DATARMNETf7d317ed55(ep);kfree(ep)
+;}}void DATARMNETf7dcab9a9e(void){if(!DATARMNETf141197982||!DATARMNET9dc7755be5)
+return;DATARMNET28d33bd09f();DATARMNET5945236cd3(DATARMNET19092afcc2);
+trace_rmnet_shs_wq_high(DATARMNETc1e19aa345,DATARMNET7cf840e991,
+(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),NULL
+,NULL);cancel_delayed_work_sync(&DATARMNET9dc7755be5->DATARMNET1150269da2);
+drain_workqueue(DATARMNETf141197982);destroy_workqueue(DATARMNETf141197982);
+kfree(DATARMNET9dc7755be5);DATARMNET9dc7755be5=NULL;DATARMNETf141197982=NULL;
+DATARMNET39391a8bc5(DATARMNETc5db038c35);DATARMNET5fb4151598();
+trace_rmnet_shs_wq_high(DATARMNETc1e19aa345,DATARMNETa5cdfd53b3,
+(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),NULL
+,NULL);}void DATARMNETd3d1d13f44(void){u8 DATARMNET42a992465f;struct 
+DATARMNET228056d4b7*DATARMNET7bea4a06a6;for(DATARMNET42a992465f=
+(0xd2d+202-0xdf7);DATARMNET42a992465f<DATARMNETc6782fed88;DATARMNET42a992465f++)
+{trace_rmnet_shs_wq_high(DATARMNET92b282b12c,DATARMNET57cad43bb7,
+DATARMNET42a992465f,(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),
+NULL,NULL);DATARMNET7bea4a06a6=&DATARMNET6cdd58e74c.DATARMNET73464778dc[
+DATARMNET42a992465f];INIT_LIST_HEAD(&DATARMNET7bea4a06a6->DATARMNETab5c1e9ad5);
+DATARMNET7bea4a06a6->DATARMNET42a992465f=DATARMNET42a992465f;}}void 
+DATARMNET4063c95208(void){int cpu;if(DATARMNETf141197982&&DATARMNET9dc7755be5)
+cancel_delayed_work_sync(&DATARMNET9dc7755be5->DATARMNET1150269da2);for(cpu=
+(0xd2d+202-0xdf7);cpu<DATARMNETc6782fed88;cpu++)DATARMNET2d482e7d9f[cpu]=
+(0xd2d+202-0xdf7);rcu_read_lock();if(((0xd26+209-0xdf6)<<DATARMNETecc0627c70.
+DATARMNET7d667e828e)&DATARMNETbc3c416b77){DATARMNETecc0627c70.
+DATARMNET5c24e1df05=(0xd26+209-0xdf6);RCU_INIT_POINTER(rmnet_shs_switch,
+DATARMNET756778f14f);DATARMNETb7ddf3c5dd[DATARMNET6ea8a58f4e]++;}rcu_read_unlock
+();}void DATARMNET7b6c061b06(void){if(DATARMNETf141197982&&DATARMNET9dc7755be5)
+queue_delayed_work(DATARMNETf141197982,&DATARMNET9dc7755be5->DATARMNET1150269da2
+,(0xd2d+202-0xdf7));}void DATARMNET3ae0d614d6(void){if(DATARMNETf141197982)
+return;DATARMNETf5f83b943f();trace_rmnet_shs_wq_high(DATARMNET9104d544fa,
+DATARMNET1b421b0381,(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),(0x16e8+787-0xc0c),
+(0x16e8+787-0xc0c),NULL,NULL);DATARMNETf141197982=alloc_workqueue(
 "\x72\x6d\x6e\x65\x74\x5f\x73\x68\x73\x5f\x77\x71",WQ_UNBOUND,(0xd26+209-0xdf6))
 ;if(!DATARMNETf141197982){DATARMNET68d84e7b98[DATARMNETecdf13872c]++;return;}
 DATARMNET9dc7755be5=kmalloc(sizeof(struct DATARMNETa144e2bd00),GFP_ATOMIC);if(!
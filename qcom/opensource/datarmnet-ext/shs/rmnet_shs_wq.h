@@ -126,6 +126,7 @@ net_device*dev);void DATARMNET0a6fb12cb2(void);int DATARMNET5f72606f6f(u16
 DATARMNETc790ff30fc,u16 DATARMNET208ea67e1d,u32 DATARMNET4da4612f1e,u32 
 DATARMNETa3f89581b5);int DATARMNETf85599b9d8(u32 DATARMNET8c11bd9466,u8 
 DATARMNET87636d0152);void DATARMNET6bf538fa23(void);void DATARMNETaea4c85748(
-void);void DATARMNETcd6e26f0ad(void);
+void);void DATARMNETcd6e26f0ad(void);void DATARMNET0cff2fcdb3(u16 cpu,u32 
+DATARMNETc96ecc4013);
 #endif 
 
@@ -29,19 +29,67 @@ DATARMNETe46ae760db);struct list_head DATARMNET3208cd0982=LIST_HEAD_INIT(
 DATARMNET3208cd0982);struct DATARMNETa41d4c4a12*DATARMNET410036d5ac;struct 
 DATARMNETa41d4c4a12*DATARMNET19c47a9f3a;struct DATARMNETa41d4c4a12*
 DATARMNET22e796eff3;struct DATARMNETa41d4c4a12*DATARMNET9b8000d2a7;struct 
-DATARMNETa41d4c4a12*DATARMNET67d31dc40a;static void DATARMNET6069bf201a(struct 
-vm_area_struct*vma){return;}static void DATARMNET0f6b7f3f93(struct 
-vm_area_struct*vma){return;}static vm_fault_t DATARMNET9efe8a3d18(struct 
-vm_fault*DATARMNETca901b4e1f){struct page*page=NULL;struct DATARMNETa41d4c4a12*
-DATARMNET54338da2ff;DATARMNET6bf538fa23();if(DATARMNET410036d5ac){
-DATARMNET54338da2ff=(struct DATARMNETa41d4c4a12*)DATARMNETca901b4e1f->vma->
-vm_private_data;if(DATARMNET54338da2ff->data){page=virt_to_page(
-DATARMNET54338da2ff->data);get_page(page);DATARMNETca901b4e1f->page=page;}else{
-DATARMNETaea4c85748();return VM_FAULT_SIGSEGV;}}else{DATARMNETaea4c85748();
-return VM_FAULT_SIGSEGV;}DATARMNETaea4c85748();return(0xd2d+202-0xdf7);}static 
-vm_fault_t DATARMNETd005aa7157(struct vm_fault*DATARMNETca901b4e1f){struct page*
-page=NULL;struct DATARMNETa41d4c4a12*DATARMNET54338da2ff;DATARMNET6bf538fa23();
-if(DATARMNET19c47a9f3a){DATARMNET54338da2ff=(struct DATARMNETa41d4c4a12*)
+DATARMNETa41d4c4a12*DATARMNET67d31dc40a;struct DATARMNETa41d4c4a12*
+DATARMNET236b5ea851;static u32 DATARMNET535a517144;static struct 
+DATARMNETfdc8eb7500 DATARMNETca8b5dd00b[DATARMNETc6782fed88+DATARMNET8caa742c8a]
+;static DEFINE_SPINLOCK(DATARMNETd7a3f0c2b6);static void DATARMNETb2e0c7a4f1(u8 
+DATARMNETaf130c556d,u16 DATARMNET42a992465f,u32 hash,u64 DATARMNET324c1a8f98,u64
+ DATARMNET253a9fc708,u64 DATARMNETbb80fccd97){struct DATARMNET45d099bb19*
+DATARMNETf19823e5f5;struct DATARMNETfdc8eb7500*DATARMNETda57c75ba0;
+DATARMNETf19823e5f5=(struct DATARMNET45d099bb19*)DATARMNET236b5ea851->data;
+DATARMNETda57c75ba0=(struct DATARMNETfdc8eb7500*)(DATARMNETf19823e5f5+
+(0xd26+209-0xdf6))+(DATARMNET535a517144%DATARMNETfb554cfb6b);DATARMNET535a517144
+++;WRITE_ONCE(DATARMNETda57c75ba0->DATARMNET8dbc605d86,(0xd2d+202-0xdf7));
+smp_wmb();DATARMNETda57c75ba0->DATARMNETaf130c556d=DATARMNETaf130c556d;
+DATARMNETda57c75ba0->hash=hash;DATARMNETda57c75ba0->DATARMNET42a992465f=
+DATARMNET42a992465f;DATARMNETda57c75ba0->DATARMNET324c1a8f98=DATARMNET324c1a8f98
+;DATARMNETda57c75ba0->DATARMNET253a9fc708=DATARMNET253a9fc708;
+DATARMNETda57c75ba0->DATARMNETbb80fccd97=DATARMNETbb80fccd97;smp_wmb();
+WRITE_ONCE(DATARMNETda57c75ba0->DATARMNET8dbc605d86,DATARMNET535a517144);
+smp_store_release(&DATARMNETf19823e5f5->DATARMNET7cb4a7830a,DATARMNET535a517144)
+;}static void DATARMNET90ba474389(u8 DATARMNETaf130c556d,u16 DATARMNET42a992465f
+,u32 hash,u64 DATARMNET324c1a8f98,u64 DATARMNET253a9fc708,u64 
+DATARMNETbb80fccd97){struct DATARMNETfdc8eb7500*DATARMNETeb8645ceea;unsigned 
+long flags;if(DATARMNETaf130c556d==DATARMNET971a8ba029){if(DATARMNET42a992465f>=
+DATARMNETc6782fed88)return;DATARMNETeb8645ceea=&DATARMNETca8b5dd00b[
+DATARMNET42a992465f];}else{DATARMNETeb8645ceea=&DATARMNETca8b5dd00b[
+DATARMNETc6782fed88+(hash&(DATARMNET8caa742c8a-(0xd26+209-0xdf6)))];}
+spin_lock_irqsave(&DATARMNETd7a3f0c2b6,flags);if(!DATARMNET236b5ea851||(
+DATARMNETeb8645ceea->DATARMNETaf130c556d==DATARMNETaf130c556d&&
+DATARMNETeb8645ceea->hash==hash&&DATARMNETeb8645ceea->DATARMNET42a992465f==
+DATARMNET42a992465f&&DATARMNETeb8645ceea->DATARMNET324c1a8f98==
+DATARMNET324c1a8f98&&DATARMNETeb8645ceea->DATARMNET253a9fc708==
+DATARMNET253a9fc708&&DATARMNETeb8645ceea->DATARMNETbb80fccd97==
+DATARMNETbb80fccd97))goto DATARMNET3f9c1b7e25;DATARMNETeb8645ceea->
+DATARMNETaf130c556d=DATARMNETaf130c556d;DATARMNETeb8645ceea->hash=hash;
+DATARMNETeb8645ceea->DATARMNET42a992465f=DATARMNET42a992465f;DATARMNETeb8645ceea
+->DATARMNET324c1a8f98=DATARMNET324c1a8f98;DATARMNETeb8645ceea->
+DATARMNET253a9fc708=DATARMNET253a9fc708;DATARMNETeb8645ceea->DATARMNETbb80fccd97
+=DATARMNETbb80fccd97;DATARMNETb2e0c7a4f1(DATARMNETaf130c556d,DATARMNET42a992465f
+,hash,DATARMNET324c1a8f98,DATARMNET253a9fc708,DATARMNETbb80fccd97);
+DATARMNET3f9c1b7e25:spin_unlock_irqrestore(&DATARMNETd7a3f0c2b6,flags);}void 
+DATARMNET5d1f0e9ab7(u32 hash,u16 DATARMNET42a992465f){struct DATARMNETfdc8eb7500
+*DATARMNETeb8645ceea;unsigned long flags;DATARMNETeb8645ceea=&
+DATARMNETca8b5dd00b[DATARMNETc6782fed88+(hash&(DATARMNET8caa742c8a-
+(0xd26+209-0xdf6)))];spin_lock_irqsave(&DATARMNETd7a3f0c2b6,flags);if(
+DATARMNETeb8645ceea->DATARMNETaf130c556d&&DATARMNETeb8645ceea->hash==hash)memset
+(DATARMNETeb8645ceea,(0xd2d+202-0xdf7),sizeof(*DATARMNETeb8645ceea));if(
+DATARMNET236b5ea851)DATARMNETb2e0c7a4f1(DATARMNET8e6b1d5f03,DATARMNET42a992465f,
+hash,(0xd2d+202-0xdf7),(0xd2d+202-0xdf7),(0xd2d+202-0xdf7));
+spin_unlock_irqrestore(&DATARMNETd7a3f0c2b6,flags);}static void 
+DATARMNET6069bf201a(struct vm_area_struct*vma){return;}static void 
+DATARMNET0f6b7f3f93(struct vm_area_struct*vma){return;}static vm_fault_t 
+DATARMNET9efe8a3d18(struct vm_fault*DATARMNETca901b4e1f){
+struct page*page=NULL;struct DATARMNETa41d4c4a12*DATARMNET54338da2ff;
+DATARMNET6bf538fa23();if(DATARMNET410036d5ac){DATARMNET54338da2ff=(struct 
+DATARMNETa41d4c4a12*)DATARMNETca901b4e1f->vma->vm_private_data;if(
+DATARMNET54338da2ff->data){page=virt_to_page(DATARMNET54338da2ff->data);get_page
+(page);DATARMNETca901b4e1f->page=page;}else{DATARMNETaea4c85748();return 
+VM_FAULT_SIGSEGV;}}else{DATARMNETaea4c85748();return VM_FAULT_SIGSEGV;}
+DATARMNETaea4c85748();return(0xd2d+202-0xdf7);}static vm_fault_t 
+DATARMNETd005aa7157(struct vm_fault*DATARMNETca901b4e1f){struct page*page=NULL;
+struct DATARMNETa41d4c4a12*DATARMNET54338da2ff;DATARMNET6bf538fa23();if(
+DATARMNET19c47a9f3a){DATARMNET54338da2ff=(struct DATARMNETa41d4c4a12*)
 DATARMNETca901b4e1f->vma->vm_private_data;if(DATARMNET54338da2ff->data){page=
 virt_to_page(DATARMNET54338da2ff->data);get_page(page);DATARMNETca901b4e1f->page
 =page;}else{DATARMNETaea4c85748();return VM_FAULT_SIGSEGV;}}else{
@@ -244,6 +292,51 @@ DATARMNET59b415aded,.proc_read=DATARMNETaf2aa1d70f,.proc_write=
 DATARMNET4761dcd3fd,};static const struct proc_ops DATARMNET6eb63d9ad0={.
 proc_mmap=DATARMNET444e2eb654,.proc_open=DATARMNETb9d10d8cc0,.proc_release=
 DATARMNET18464ea5e3,.proc_read=DATARMNETaf2aa1d70f,.proc_write=
+DATARMNET4761dcd3fd,};static vm_fault_t DATARMNET9c4b84add4(struct vm_fault*
+DATARMNETca901b4e1f){struct page*page=NULL;struct DATARMNETa41d4c4a12*
+DATARMNET54338da2ff;unsigned long flags;spin_lock_irqsave(&DATARMNETd7a3f0c2b6,
+flags);DATARMNET54338da2ff=(struct DATARMNETa41d4c4a12*)DATARMNETca901b4e1f->vma
+->vm_private_data;if(!DATARMNET236b5ea851||!DATARMNET54338da2ff||!
+DATARMNET54338da2ff->data){spin_unlock_irqrestore(&DATARMNETd7a3f0c2b6,flags);
+return VM_FAULT_SIGSEGV;}page=virt_to_page(DATARMNET54338da2ff->data);get_page(
+page);DATARMNETca901b4e1f->page=page;spin_unlock_irqrestore(&DATARMNETd7a3f0c2b6
+,flags);return(0xd2d+202-0xdf7);}static const struct vm_operations_struct 
+DATARMNET6fff708b2e={.close=DATARMNET0f6b7f3f93,.open=DATARMNET6069bf201a,.fault
+=DATARMNET9c4b84add4,};static int DATARMNET7a48b626c0(struct file*
+DATARMNET3cc114dce0,struct vm_area_struct*vma){if(vma->vm_flags&VM_WRITE)return-
+EPERM;vma->vm_ops=&DATARMNET6fff708b2e;vma->vm_flags&=~VM_MAYWRITE;vma->vm_flags
+|=VM_DONTEXPAND|VM_DONTDUMP;vma->vm_private_data=DATARMNET3cc114dce0->
+private_data;return(0xd2d+202-0xdf7);}static int DATARMNET9ebd7dec2f(struct 
+inode*inode,struct file*DATARMNET3cc114dce0){struct DATARMNETa41d4c4a12*
+DATARMNET54338da2ff;struct DATARMNET45d099bb19*DATARMNETf19823e5f5;unsigned long
+ flags;rm_err("\x25\x73",
+"\x53\x48\x53\x5f\x4d\x45\x4d\x3a\x20\x72\x6d\x6e\x65\x74\x5f\x73\x68\x73\x5f\x6f\x70\x65\x6e\x20\x64\x65\x6c\x74\x61\x20\x2d\x20\x65\x6e\x74\x72\x79\x0a"
+);spin_lock_irqsave(&DATARMNETd7a3f0c2b6,flags);if(!DATARMNET236b5ea851){
+DATARMNET54338da2ff=kzalloc(sizeof(struct DATARMNETa41d4c4a12),GFP_ATOMIC);if(!
+DATARMNET54338da2ff)goto DATARMNET1d7e728ddf;DATARMNET54338da2ff->data=(char*)
+get_zeroed_page(GFP_ATOMIC);if(!DATARMNET54338da2ff->data){kfree(
+DATARMNET54338da2ff);goto DATARMNET1d7e728ddf;}DATARMNETf19823e5f5=(struct 
+DATARMNET45d099bb19*)DATARMNET54338da2ff->data;DATARMNETf19823e5f5->
+DATARMNETa9a3380103=DATARMNETfb554cfb6b;DATARMNETf19823e5f5->DATARMNET5257299656
+=sizeof(struct DATARMNETfdc8eb7500);DATARMNET535a517144=(0xd2d+202-0xdf7);memset
+(DATARMNETca8b5dd00b,(0xd2d+202-0xdf7),sizeof(DATARMNETca8b5dd00b));
+DATARMNET236b5ea851=DATARMNET54338da2ff;refcount_set(&DATARMNET236b5ea851->
+refcnt,(0xd26+209-0xdf6));}else{refcount_inc(&DATARMNET236b5ea851->refcnt);}
+DATARMNET3cc114dce0->private_data=DATARMNET236b5ea851;spin_unlock_irqrestore(&
+DATARMNETd7a3f0c2b6,flags);return(0xd2d+202-0xdf7);DATARMNET1d7e728ddf:
+spin_unlock_irqrestore(&DATARMNETd7a3f0c2b6,flags);return-ENOMEM;}static int 
+DATARMNET52497f4224(struct inode*inode,struct file*DATARMNET3cc114dce0){struct 
+DATARMNETa41d4c4a12*DATARMNET54338da2ff;unsigned long flags;rm_err("\x25\x73",
+"\x53\x48\x53\x5f\x4d\x45\x4d\x3a\x20\x72\x6d\x6e\x65\x74\x5f\x73\x68\x73\x5f\x72\x65\x6c\x65\x61\x73\x65\x20\x64\x65\x6c\x74\x61\x20\x2d\x20\x65\x6e\x74\x72\x79\x0a"
+);spin_lock_irqsave(&DATARMNETd7a3f0c2b6,flags);if(DATARMNET236b5ea851){
+DATARMNET54338da2ff=DATARMNET3cc114dce0->private_data;if(refcount_read(&
+DATARMNET54338da2ff->refcnt)<=(0xd26+209-0xdf6)){free_page((unsigned long)
+DATARMNET54338da2ff->data);kfree(DATARMNET54338da2ff);DATARMNET236b5ea851=NULL;
+DATARMNET3cc114dce0->private_data=NULL;}else{refcount_dec(&DATARMNET54338da2ff->
+refcnt);}}spin_unlock_irqrestore(&DATARMNETd7a3f0c2b6,flags);return
+(0xd2d+202-0xdf7);}static const struct proc_ops DATARMNET825754fa3a={.
+proc_mmap=DATARMNET7a48b626c0,.proc_open=DATARMNET9ebd7dec2f,.proc_release=
+DATARMNET52497f4224,.proc_read=DATARMNETaf2aa1d70f,.proc_write=
 DATARMNET4761dcd3fd,};void DATARMNET28a80d526e(struct DATARMNET6c78e47d24*
 DATARMNETd2a694d52a,struct list_head*DATARMNETf0fb155a9c){struct 
 DATARMNETa52c09a590*DATARMNET0f551e8a47;if(!DATARMNETd2a694d52a||!
@@ -364,7 +457,11 @@ DATARMNETace28a2c7f->DATARMNET4da6031170;DATARMNET63c47f3c37[idx].
 DATARMNET18b7a5b761=DATARMNETace28a2c7f->DATARMNET18b7a5b761;DATARMNET63c47f3c37
 [idx].DATARMNET4df302dbd6=DATARMNETace28a2c7f->DATARMNET4df302dbd6;
 DATARMNET63c47f3c37[idx].DATARMNET42a992465f=DATARMNETace28a2c7f->
-DATARMNET42a992465f;idx+=(0xd26+209-0xdf6);}rm_err(
+DATARMNET42a992465f;DATARMNET90ba474389(DATARMNET971a8ba029,DATARMNETace28a2c7f
+->DATARMNET42a992465f,(0xd2d+202-0xdf7),DATARMNETace28a2c7f->DATARMNET18b7a5b761
+,DATARMNETace28a2c7f->DATARMNET4da6031170,DATARMNETace28a2c7f->
+DATARMNET4df302dbd6);idx+=(0xd26+209-0xdf6);}if(!DATARMNETd9169fe898)return;
+rm_err(
 "\x53\x48\x53\x5f\x4d\x45\x4d\x3a\x20\x63\x61\x70\x5f\x64\x6d\x61\x5f\x70\x74\x72\x20\x3d\x20\x30\x78\x25\x6c\x6c\x78\x20\x61\x64\x64\x72\x20\x3d\x20\x30\x78\x25\x70\x4b" "\n"
 ,(unsigned long long)virt_to_phys((void*)DATARMNET410036d5ac),
 DATARMNET410036d5ac);if(!DATARMNET410036d5ac){rm_err("\x25\x73",
@@ -387,7 +484,11 @@ DATARMNET4238158b2a->DATARMNET42a992465f);DATARMNETcde08f6e7d+=(0xd26+209-0xdf6)
 DATARMNET42a992465f;DATARMNET22b4032799[idx].hash=DATARMNET4238158b2a->hash;
 DATARMNET22b4032799[idx].DATARMNET253a9fc708=DATARMNET4238158b2a->
 DATARMNET253a9fc708;DATARMNET22b4032799[idx].DATARMNET324c1a8f98=
-DATARMNET4238158b2a->DATARMNET324c1a8f98;idx+=(0xd26+209-0xdf6);}rm_err(
+DATARMNET4238158b2a->DATARMNET324c1a8f98;DATARMNET90ba474389(DATARMNET677404b59c
+,DATARMNET4238158b2a->DATARMNET42a992465f,DATARMNET4238158b2a->hash,
+DATARMNET4238158b2a->DATARMNET324c1a8f98,DATARMNET4238158b2a->
+DATARMNET253a9fc708,(0xd2d+202-0xdf7));idx+=(0xd26+209-0xdf6);}if(!
+DATARMNETd9169fe898)return;rm_err(
 "\x53\x48\x53\x5f\x4d\x45\x4d\x3a\x20\x67\x66\x6c\x6f\x77\x5f\x64\x6d\x61\x5f\x70\x74\x72\x20\x3d\x20\x30\x78\x25\x6c\x6c\x78\x20\x61\x64\x64\x72\x20\x3d\x20\x30\x78\x25\x70\x4b" "\n"
 ,(unsigned long long)virt_to_phys((void*)DATARMNET19c47a9f3a),
 DATARMNET19c47a9f3a);if(!DATARMNET19c47a9f3a){rm_err("\x25\x73",
@@ -414,8 +515,12 @@ DATARMNET42a992465f;DATARMNETb0d78d576f[idx].hash=DATARMNET0f551e8a47->hash;
 DATARMNETb0d78d576f[idx].DATARMNET253a9fc708=DATARMNET0f551e8a47->
 DATARMNET253a9fc708;DATARMNETb0d78d576f[idx].DATARMNET324c1a8f98=
 DATARMNET0f551e8a47->DATARMNET324c1a8f98;DATARMNETb0d78d576f[idx].
-DATARMNETbb80fccd97=DATARMNET0f551e8a47->DATARMNETbb80fccd97;idx+=
-(0xd26+209-0xdf6);}rm_err(
+DATARMNETbb80fccd97=DATARMNET0f551e8a47->DATARMNETbb80fccd97;DATARMNET90ba474389
+(DATARMNETfe4837cdea,DATARMNET0f551e8a47->DATARMNET42a992465f,
+DATARMNET0f551e8a47->hash,DATARMNET0f551e8a47->DATARMNET324c1a8f98,
+DATARMNET0f551e8a47->DATARMNET253a9fc708,DATARMNET0f551e8a47->
+DATARMNETbb80fccd97);idx+=(0xd26+209-0xdf6);}if(!DATARMNETd9169fe898)return;
+rm_err(
 "\x53\x48\x53\x5f\x4d\x45\x4d\x3a\x20\x73\x73\x66\x6c\x6f\x77\x5f\x64\x6d\x61\x5f\x70\x74\x72\x20\x3d\x20\x30\x78\x25\x6c\x6c\x78\x20\x61\x64\x64\x72\x20\x3d\x20\x30\x78\x25\x70\x4b" "\n"
 ,(unsigned long long)virt_to_phys((void*)DATARMNET22e796eff3),
 DATARMNET22e796eff3);if(!DATARMNET22e796eff3){rm_err("\x25\x73",
@@ -505,8 +610,9 @@ DATARMNET67d31dc40a);if(!DATARMNET67d31dc40a){rm_err("\x25\x73",
 );return;}memcpy(((char*)DATARMNET67d31dc40a->data),&idx,sizeof(idx));memcpy(((
 char*)DATARMNET67d31dc40a->data+sizeof(uint16_t)),(void*)&DATARMNETf46265286b[
 (0xd2d+202-0xdf7)],sizeof(DATARMNETf46265286b));}void DATARMNETf5f83b943f(void){
-kuid_t DATARMNETdaca088404;kgid_t DATARMNET254aa091f2;DATARMNETe4c5563cdb=
-proc_mkdir("\x73\x68\x73",NULL);if(!DATARMNETe4c5563cdb){rm_err("\x25\x73",
+unsigned long flags;kuid_t DATARMNETdaca088404;kgid_t DATARMNET254aa091f2;
+DATARMNETe4c5563cdb=proc_mkdir("\x73\x68\x73",NULL);if(!DATARMNETe4c5563cdb){
+rm_err("\x25\x73",
 "\x53\x48\x53\x5f\x4d\x45\x4d\x5f\x49\x4e\x49\x54\x3a\x20\x46\x61\x69\x6c\x65\x64\x20\x74\x6f\x20\x63\x72\x65\x61\x74\x65\x20\x70\x72\x6f\x63\x20\x64\x69\x72"
 );return;}DATARMNETdaca088404=make_kuid(&init_user_ns,(0xdc7+2646-0x1434));
 DATARMNET254aa091f2=make_kgid(&init_user_ns,(0xdc7+2646-0x1434));if(uid_valid(
@@ -518,13 +624,18 @@ DATARMNETe84fbaa6af);proc_create(DATARMNETeb2a21dd7c,(0xdb7+6665-0x261c),
 DATARMNETe4c5563cdb,&DATARMNET8fe5f892a8);proc_create(DATARMNET1c4ea23858,
 (0xdb7+6665-0x261c),DATARMNETe4c5563cdb,&DATARMNET0104d40d4b);proc_create(
 DATARMNETe98d39b779,(0xdb7+6665-0x261c),DATARMNETe4c5563cdb,&DATARMNET6eb63d9ad0
-);DATARMNET6bf538fa23();DATARMNET410036d5ac=NULL;DATARMNET19c47a9f3a=NULL;
-DATARMNET22e796eff3=NULL;DATARMNET9b8000d2a7=NULL;DATARMNET67d31dc40a=NULL;
-DATARMNETaea4c85748();}void DATARMNET28d33bd09f(void){remove_proc_entry(
-DATARMNET41be983a65,DATARMNETe4c5563cdb);remove_proc_entry(DATARMNET5ddc91451c,
-DATARMNETe4c5563cdb);remove_proc_entry(DATARMNETeb2a21dd7c,DATARMNETe4c5563cdb);
-remove_proc_entry(DATARMNET1c4ea23858,DATARMNETe4c5563cdb);remove_proc_entry(
-DATARMNETe98d39b779,DATARMNETe4c5563cdb);remove_proc_entry(DATARMNET6517f07a36,
+);proc_create(DATARMNET25ff3cf0ae,(0xcb7+5769-0x221c),DATARMNETe4c5563cdb,&
+DATARMNET825754fa3a);DATARMNET6bf538fa23();DATARMNET410036d5ac=NULL;
+DATARMNET19c47a9f3a=NULL;DATARMNET22e796eff3=NULL;DATARMNET9b8000d2a7=NULL;
+DATARMNET67d31dc40a=NULL;DATARMNETaea4c85748();spin_lock_irqsave(&
+DATARMNETd7a3f0c2b6,flags);DATARMNET236b5ea851=NULL;spin_unlock_irqrestore(&
+DATARMNETd7a3f0c2b6,flags);}void DATARMNET28d33bd09f(void){unsigned long flags;
+remove_proc_entry(DATARMNET41be983a65,DATARMNETe4c5563cdb);remove_proc_entry(
+DATARMNET5ddc91451c,DATARMNETe4c5563cdb);remove_proc_entry(DATARMNETeb2a21dd7c,
+DATARMNETe4c5563cdb);remove_proc_entry(DATARMNET1c4ea23858,DATARMNETe4c5563cdb);
+remove_proc_entry(DATARMNETe98d39b779,DATARMNETe4c5563cdb);remove_proc_entry(
+DATARMNET25ff3cf0ae,DATARMNETe4c5563cdb);remove_proc_entry(DATARMNET6517f07a36,
 NULL);DATARMNET6bf538fa23();DATARMNET410036d5ac=NULL;DATARMNET19c47a9f3a=NULL;
 DATARMNET22e796eff3=NULL;DATARMNET9b8000d2a7=NULL;DATARMNET67d31dc40a=NULL;
-DATARMNETaea4c85748();}
+DATARMNETaea4c85748();spin_lock_irqsave(&DATARMNETd7a3f0c2b6,flags);
+DATARMNET236b5ea851=NULL;spin_unlock_irqrestore(&DATARMNETd7a3f0c2b6,flags);}
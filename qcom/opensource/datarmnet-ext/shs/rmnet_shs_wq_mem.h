@@ -30,6 +30,9 @@
 #define DATARMNETe4d15b9332 ((0xec7+1166-0x132d))
 #define DATARMNET9ae5f81f71 ((0xeb7+1158-0x132d))
 #define DATARMNET29d29f44cf ((0xd2d+202-0xdf7))
+#define DATARMNET25ff3cf0ae   \
+"\x72\x6d\x6e\x65\x74\x5f\x73\x68\x73\x5f\x64\x65\x6c\x74\x61"
+#define DATARMNET8caa742c8a ((0xef7+1142-0x132d))
 struct __attribute__((__packed__))DATARMNET33582f7450{u64 DATARMNET18b7a5b761;
 u64 DATARMNET4da6031170;u64 DATARMNET4df302dbd6;u16 DATARMNET42a992465f;};struct
  __attribute__((__packed__))DATARMNETf44cda1bf2{u64 DATARMNET324c1a8f98;u64 
@@ -48,7 +51,18 @@ coal_udp_bytes;u64 DATARMNET257fc4b2d4;u64 DATARMNET4eb77c78e6;u8 mux_id;};
 extern struct list_head DATARMNET6c23f11e81;extern struct list_head 
 DATARMNETf91b305f4e;extern struct list_head DATARMNET3208cd0982;extern struct 
 list_head DATARMNETe46ae760db;enum{DATARMNETbd4083a6a4=(0x24f5+499-0x16e8)};
-struct DATARMNETa41d4c4a12{char*data;refcount_t refcnt;};void 
+struct DATARMNETa41d4c4a12{char*data;refcount_t refcnt;};enum{
+DATARMNET971a8ba029=(0xd26+209-0xdf6),DATARMNET677404b59c,DATARMNETfe4837cdea,
+DATARMNET8e6b1d5f03,};
+struct __attribute__((__packed__))DATARMNET45d099bb19{u32 DATARMNET7cb4a7830a;
+u32 DATARMNETa9a3380103;u32 DATARMNET5257299656;u32 DATARMNET2ad4b7543d;};struct
+ __attribute__((__packed__))DATARMNETfdc8eb7500{u32 DATARMNET8dbc605d86;u32 hash
+;u64 DATARMNET324c1a8f98;u64 DATARMNET253a9fc708;u64 DATARMNETbb80fccd97;u16 
+DATARMNET42a992465f;u8 DATARMNETaf130c556d;u8 DATARMNET2ad4b7543d;u32 
+DATARMNETccd3f5067b;};
+#define DATARMNETfb554cfb6b ((DATARMNETbd4083a6a4-sizeof(struct \
+DATARMNET45d099bb19))/sizeof(struct DATARMNETfdc8eb7500))
+void DATARMNET5d1f0e9ab7(u32 hash,u16 DATARMNET42a992465f);void 
 DATARMNET28a80d526e(struct DATARMNET6c78e47d24*DATARMNETd2a694d52a,struct 
 list_head*DATARMNETf0fb155a9c);void DATARMNET24e4475345(struct 
 DATARMNET6c78e47d24*DATARMNETd2a694d52a,struct list_head*DATARMNETb436c3f30b);
@@ -246,6 +246,34 @@ TRACE_EVENT(dfc_tx_link_status_ind,
 		__entry->mid, __entry->bid)
 );
 
+TRACE_EVENT(dfc_ind_batch,
+
+	TP_PROTO(int src, u32 count, u32 coalesced, u64 batches,
+		 u64 total_coalesced),
+
+	TP_ARGS(src, count, coalesced, batches, total_coalesced),
+
+	TP_STRUCT__entry(
+		__field(int, src)
+		__field(u32, count)
+		__field(u32, coalesced)
+		__field(u64, batches)
+		__field(u64, total_coalesced)
+	),
+
+	TP_fast_assign(
+		__entry->src = src;
+		__entry->count = count;
+		__entry->coalesced = coalesced;
+		__entry->batches = batches;
+		__entry->total_coalesced = total_coalesced;
+	),
+
+	TP_printk("src=%d ind=%u coalesced=%u batches=%llu total_coalesced=%llu",
+		__entry->src, __entry->count, __entry->coalesced,
+		__entry->batches, __entry->total_coalesced)
+);
+
 TRACE_EVENT(dfc_qmap,
 
 	TP_PROTO(const void *data, size_t len, bool in),
@@ -349,6 +377,33 @@ TRACE_EVENT(dfc_ll_switch,
 			      __entry->num_bearer, 1))
 );
 
+TRACE_EVENT(dfc_pace,
+
+	TP_PROTO(u8 mux_id, u8 bearer_id, u32 rate, u32 grant, u32 hold_us),
+
+	TP_ARGS(mux_id, bearer_id, rate, grant, hold_us),
+
+	TP_STRUCT__entry(
+		__field(u8, mid)
+		__field(u8, bid)
+		__field(u32, rate)
+		__field(u32, grant)
+		__field(u32, hold_us)
+	),
+
+	TP_fast_assign(
+		__entry->mid = mux_id;
+		__entry->bid = bearer_id;
+		__entry->rate = rate;
+		__entry->grant = grant;
+		__entry->hold_us = hold_us;
+	),
+
+	TP_printk("mid=%u bid=%u rate=%u B/ms grant=%u hold=%uus",
+		__entry->mid, __entry->bid, __entry->rate,
+		__entry->grant, __entry->hold_us)
+);
+
 TRACE_EVENT(dfc_set_powersave_mode,
 
 	TP_PROTO(int enable),
@@ -32,6 +32,9 @@ struct dfc_qmi_data {
 	spinlock_t qmi_ind_lock;
 	int index;
 	int restart_state;
+	u64 ind_batches;
+	u64 ind_processed;
+	u64 ind_coalesced;
 };
 
 enum dfc_ip_type_enum_v01 {
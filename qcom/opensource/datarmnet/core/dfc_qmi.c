@@ -271,6 +271,7 @@ struct dfc_get_flow_status_resp_msg_v01 {
 struct dfc_svc_ind {
 	struct list_head list;
 	u16 msg_id;
+	u16 skip_mask;
 	union {
 		struct dfc_flow_status_ind_msg_v01 dfc_info;
 		struct dfc_tx_link_status_ind_msg_v01 tx_status;
@@ -920,6 +921,26 @@ dfc_send_ack(struct net_device *dev, u8 bearer_id, u16 seq, u8 mux_id, u8 type)
 	rmnet_map_tx_qmap_cmd(skb, RMNET_CH_DEFAULT, true);
 }
 
+/* Drop any pacing hold on a grant update. Needs qos_lock held. The
+ * timer callback also takes qos_lock, so the timer can only be try
+ * cancelled here; a callback already waiting on the lock finds the
+ * hold cleared and does nothing.
+ */
+void dfc_pace_release(struct net_device *dev,
+		      struct rmnet_bearer_map *bearer, bool wake)
+{
+	bearer->pace_next = 0;
+
+	if (!bearer->pace_stopped)
+		return;
+
+	hrtimer_try_to_cancel(&bearer->pace_timer);
+	bearer->pace_stopped = false;
+
+	if (wake && bearer->grant_size && bearer->mq_idx != INVALID_MQ)
+		qmi_rmnet_flow_control(dev, bearer->mq_idx, 1);
+}
+
 int dfc_bearer_flow_ctl(struct net_device *dev,
 			struct rmnet_bearer_map *bearer,
 			struct qos_info *qos)
@@ -927,6 +948,7 @@ int dfc_bearer_flow_ctl(struct net_device *dev,
 	bool enable;
 
 	enable = bearer->grant_size ? true : false;
+	dfc_pace_release(dev, bearer, false);
 
 	/* Do not flow disable tcp ack q in tcp bidir
 	 * ACK queue opened first to drain ACKs faster
@@ -949,6 +971,112 @@ int dfc_bearer_flow_ctl(struct net_device *dev,
 	return 0;
 }
 
+/* Grant pacing
+ *
+ * Without pacing a bearer sends at line rate until its grant runs out,
+ * then sits stopped until the modem replenishes it. With pacing on, the
+ * replenish rate is estimated from consecutive grant indications and,
+ * once the remaining grant falls below DFC_PACE_WINDOW_MS worth of that
+ * rate, the queue is held briefly whenever it gets more than
+ * DFC_PACE_HORIZON_NS ahead of schedule. The queue then drains the
+ * grant across the expected window instead of emptying it in a burst.
+ */
+#define DFC_PACE_WINDOW_MS 20
+#define DFC_PACE_MAX_GAP_US (500 * USEC_PER_MSEC)
+#define DFC_PACE_HORIZON_NS (2 * NSEC_PER_MSEC)
+
+static void dfc_pace_update(struct rmnet_bearer_map *bearer, u32 grant)
+{
+	ktime_t now = ktime_get();
+	s64 us = ktime_us_delta(now, bearer->pace_last_ind);
+	u64 supplied;
+	u32 sample;
+
+	/* Credit added by the modem since the last indication is the new
+	 * grant plus what was sent in between, minus the previous grant.
+	 */
+	if (bearer->pace_last_ind && us > 0 && us < DFC_PACE_MAX_GAP_US) {
+		supplied = (u64)grant + bearer->pace_sent;
+		if (supplied > bearer->last_grant) {
+			sample = div64_u64((supplied - bearer->last_grant) *
+					   USEC_PER_MSEC, us);
+			if (bearer->pace_rate)
+				bearer->pace_rate = bearer->pace_rate -
+						    (bearer->pace_rate >> 3) +
+						    (sample >> 3);
+			else
+				bearer->pace_rate = sample;
+		}
+	}
+
+	bearer->pace_last_ind = now;
+	bearer->pace_sent = 0;
+}
+
+static void dfc_pace_check(struct net_device *dev,
+			   struct rmnet_bearer_map *bearer, unsigned int len)
+{
+	ktime_t now;
+	u32 rate;
+	s64 ahead;
+
+	bearer->pace_sent += len;
+
+	if (!bearer->pace_rate || bearer->pace_stopped ||
+	    bearer->mq_idx == INVALID_MQ)
+		return;
+
+	if (bearer->grant_size >= bearer->pace_rate * DFC_PACE_WINDOW_MS) {
+		bearer->pace_next = 0;
+		return;
+	}
+
+	/* Run slightly above the estimate so pacing is never the limit */
+	rate = bearer->pace_rate + (bearer->pace_rate >> 2);
+	now = ktime_get();
+	if (ktime_before(bearer->pace_next, now))
+		bearer->pace_next = now;
+	bearer->pace_next = ktime_add_ns(bearer->pace_next,
+					 div_u64((u64)len * NSEC_PER_MSEC,
+						 rate));
+
+	ahead = ktime_to_ns(ktime_sub(bearer->pace_next, now));
+	if (ahead <= DFC_PACE_HORIZON_NS)
+		return;
+
+	trace_dfc_pace(bearer->qos->mux_id, bearer->bearer_id,
+		       bearer->pace_rate, bearer->grant_size,
+		       (u32)div_u64(ahead - DFC_PACE_HORIZON_NS,
+				    NSEC_PER_USEC));
+
+	/* ACK queue is left open */
+	bearer->pace_stopped = true;
+	qmi_rmnet_flow_control(dev, bearer->mq_idx, 0);
+	hrtimer_start(&bearer->pace_timer,
+		      ns_to_ktime(ahead - DFC_PACE_HORIZON_NS),
+		      HRTIMER_MODE_REL_SOFT);
+}
+
+enum hrtimer_restart dfc_pace_timer_fn(struct hrtimer *t)
+{
+	struct rmnet_bearer_map *bearer;
+
+	bearer = container_of(t, struct rmnet_bearer_map, pace_timer);
+
+	spin_lock_bh(&bearer->qos->qos_lock);
+
+	if (bearer->pace_stopped) {
+		bearer->pace_stopped = false;
+		if (bearer->grant_size && bearer->mq_idx != INVALID_MQ)
+			qmi_rmnet_flow_control(bearer->qos->vnd_dev,
+					       bearer->mq_idx, 1);
+	}
+
+	spin_unlock_bh(&bearer->qos->qos_lock);
+
+	return HRTIMER_NORESTART;
+}
+
 static int dfc_all_bearer_flow_ctl(struct net_device *dev,
 				struct qos_info *qos, u8 ack_req, u32 ancillary,
 				struct dfc_flow_status_info_type_v01 *fc_info)
@@ -1072,6 +1200,9 @@ static int dfc_update_fc_map(struct net_device *dev, struct qos_info *qos,
 			qmi_rmnet_watchdog_remove(itm);
 		}
 
+		if (dfc_pacing && !is_query)
+			dfc_pace_update(itm, fc_info->num_bytes);
+
 		itm->seq = fc_info->seq_num;
 		itm->ack_req = ack_req;
 		itm->tcp_bidir = DFC_IS_TCP_BIDIR(ancillary);
@@ -1081,17 +1212,20 @@ static int dfc_update_fc_map(struct net_device *dev, struct qos_info *qos,
 
 		if (action)
 			rc = dfc_bearer_flow_ctl(dev, itm, qos);
+		else
+			dfc_pace_release(dev, itm, true);
 	}
 
 	return rc;
 }
 
-void dfc_do_burst_flow_control(struct dfc_qmi_data *dfc,
-			       struct dfc_flow_status_ind_msg_v01 *ind,
-			       bool is_query)
+static void __dfc_do_burst_flow_control(struct dfc_qmi_data *dfc,
+					struct dfc_flow_status_ind_msg_v01 *ind,
+					bool is_query, u16 skip_mask)
 {
 	struct net_device *dev;
 	struct qos_info *qos;
+	struct qos_info *locked_qos = NULL;
 	struct dfc_flow_status_info_type_v01 *flow_status;
 	struct dfc_ancillary_info_type_v01 *ai;
 	u8 ack_req = ind->eod_ack_reqd_valid ? ind->eod_ack_reqd : 0;
@@ -1103,6 +1237,10 @@ void dfc_do_burst_flow_control(struct dfc_qmi_data *dfc,
 	for (i = 0; i < ind->flow_status_len; i++) {
 		flow_status = &ind->flow_status[i];
 
+		/* Superseded by a later grant in the same batch */
+		if (skip_mask & BIT(i))
+			continue;
+
 		ancillary = 0;
 		if (ind->ancillary_info_valid) {
 			for (j = 0; j < ind->ancillary_info_len; j++) {
@@ -1132,7 +1270,15 @@ void dfc_do_burst_flow_control(struct dfc_qmi_data *dfc,
 		if (!qos)
 			continue;
 
-		spin_lock_bh(&qos->qos_lock);
+		/* Entries are usually grouped by mux id. Keep the qos
+		 * lock across consecutive entries of the same device.
+		 */
+		if (qos != locked_qos) {
+			if (locked_qos)
+				spin_unlock_bh(&locked_qos->qos_lock);
+			spin_lock_bh(&qos->qos_lock);
+			locked_qos = qos;
+		}
 
 		/* In powersave, change grant to 1 if it is a enable */
 		if (qmi_rmnet_ignore_grant(dfc->rmnet_port)) {
@@ -1143,7 +1289,6 @@ void dfc_do_burst_flow_control(struct dfc_qmi_data *dfc,
 				flow_status->rx_bytes_valid = 1;
 				flow_status->rx_bytes = 0xFFFFFFFF;
 			} else {
-				spin_unlock_bh(&qos->qos_lock);
 				continue;
 			}
 		}
@@ -1155,14 +1300,21 @@ void dfc_do_burst_flow_control(struct dfc_qmi_data *dfc,
 			dfc_update_fc_map(
 				dev, qos, ack_req, ancillary, flow_status,
 				is_query);
-
-		spin_unlock_bh(&qos->qos_lock);
 	}
 
 clean_out:
+	if (locked_qos)
+		spin_unlock_bh(&locked_qos->qos_lock);
 	rcu_read_unlock();
 }
 
+void dfc_do_burst_flow_control(struct dfc_qmi_data *dfc,
+			       struct dfc_flow_status_ind_msg_v01 *ind,
+			       bool is_query)
+{
+	__dfc_do_burst_flow_control(dfc, ind, is_query, 0);
+}
+
 static void dfc_update_tx_link_status(struct net_device *dev,
 				      struct qos_info *qos, u8 tx_status,
 				      struct dfc_bearer_info_type_v01 *binfo)
@@ -1233,44 +1385,140 @@ clean_out:
 	rcu_read_unlock();
 }
 
+#define DFC_COALESCE_MAX 64
+
+struct dfc_coalesce_key {
+	u8 mux_id;
+	u8 bearer_id;
+	u32 num_bytes;
+};
+
+/* An earlier flow status entry can be dropped when a later indication
+ * in the same batch carries a grant for the same bearer. Entries that
+ * need an ack, carry ancillary info or switch channels are always
+ * applied, and a tx link status or an all-bearer grant ends the window.
+ */
+static bool dfc_coalesce_ok(struct dfc_flow_status_ind_msg_v01 *ind,
+			    struct dfc_flow_status_info_type_v01 *fs,
+			    struct dfc_coalesce_key *later)
+{
+	if (ind->eod_ack_reqd_valid && ind->eod_ack_reqd)
+		return false;
+
+	if (ind->ancillary_info_valid || fs->ll_status)
+		return false;
+
+	/* A grant may create the bearer, keep it unless a later grant
+	 * would do the same.
+	 */
+	return !fs->num_bytes || later->num_bytes;
+}
+
+static u32 dfc_coalesce_ind(struct list_head *batch)
+{
+	struct dfc_coalesce_key seen[DFC_COALESCE_MAX];
+	struct dfc_flow_status_ind_msg_v01 *ind;
+	struct dfc_flow_status_info_type_v01 *fs;
+	struct dfc_svc_ind *svc_ind;
+	int n = 0, i, k;
+	u32 coalesced = 0;
+
+	list_for_each_entry_reverse(svc_ind, batch, list) {
+		if (svc_ind->msg_id != QMI_DFC_FLOW_STATUS_IND_V01) {
+			n = 0;
+			continue;
+		}
+
+		ind = &svc_ind->d.dfc_info;
+
+		for (i = ind->flow_status_len - 1; i >= 0; i--) {
+			fs = &ind->flow_status[i];
+
+			if (unlikely(fs->bearer_id == 0xFF)) {
+				n = 0;
+				continue;
+			}
+
+			for (k = 0; k < n; k++) {
+				if (seen[k].mux_id == fs->mux_id &&
+				    seen[k].bearer_id == fs->bearer_id)
+					break;
+			}
+
+			if (k < n) {
+				if (dfc_coalesce_ok(ind, fs, &seen[k])) {
+					svc_ind->skip_mask |= BIT(i);
+					coalesced++;
+				}
+				continue;
+			}
+
+			if (n < DFC_COALESCE_MAX) {
+				seen[n].mux_id = fs->mux_id;
+				seen[n].bearer_id = fs->bearer_id;
+				seen[n].num_bytes = fs->num_bytes;
+				n++;
+			}
+		}
+	}
+
+	return coalesced;
+}
+
 static void dfc_qmi_ind_work(struct work_struct *work)
 {
 	struct dfc_qmi_data *dfc = container_of(work, struct dfc_qmi_data,
 						qmi_ind_work);
-	struct dfc_svc_ind *svc_ind;
+	struct dfc_svc_ind *svc_ind, *tmp;
 	unsigned long flags;
+	LIST_HEAD(batch);
+	u32 count = 0;
+	u32 coalesced = 0;
 
 	if (!dfc)
 		return;
 
-	local_bh_disable();
+	/* Drain everything pending in one go so that back to back grants
+	 * for the same bearer only toggle its queue once.
+	 */
+	spin_lock_irqsave(&dfc->qmi_ind_lock, flags);
+	list_splice_tail_init(&dfc->qmi_ind_q, &batch);
+	spin_unlock_irqrestore(&dfc->qmi_ind_lock, flags);
 
-	do {
-		spin_lock_irqsave(&dfc->qmi_ind_lock, flags);
-		svc_ind = list_first_entry_or_null(&dfc->qmi_ind_q,
-						   struct dfc_svc_ind, list);
-		if (svc_ind)
-			list_del(&svc_ind->list);
-		spin_unlock_irqrestore(&dfc->qmi_ind_lock, flags);
+	if (list_empty(&batch))
+		goto out;
 
-		if (!svc_ind)
-			break;
+	if (!list_is_singular(&batch))
+		coalesced = dfc_coalesce_ind(&batch);
+
+	local_bh_disable();
+
+	list_for_each_entry_safe(svc_ind, tmp, &batch, list) {
+		list_del(&svc_ind->list);
+		count++;
 
 		if (!dfc->restart_state) {
 			if (svc_ind->msg_id == QMI_DFC_FLOW_STATUS_IND_V01)
-				dfc_do_burst_flow_control(
+				__dfc_do_burst_flow_control(
 						dfc, &svc_ind->d.dfc_info,
-						false);
+						false, svc_ind->skip_mask);
 			else if (svc_ind->msg_id ==
 					QMI_DFC_TX_LINK_STATUS_IND_V01)
 				dfc_handle_tx_link_status_ind(
 						dfc, &svc_ind->d.tx_status);
 		}
 		kfree(svc_ind);
-	} while (1);
+	}
 
 	local_bh_enable();
 
+	dfc->ind_batches++;
+	dfc->ind_processed += count;
+	dfc->ind_coalesced += coalesced;
+	trace_dfc_ind_batch(dfc->index, count, coalesced,
+			    dfc->ind_batches, dfc->ind_coalesced);
+
+out:
 	qmi_rmnet_set_dl_msg_active(dfc->rmnet_port);
 }
 
@@ -1549,6 +1797,8 @@ void dfc_qmi_burst_check(struct net_device *dev, struct qos_info *qos,
 
 	if (!bearer->grant_size)
 		dfc_bearer_flow_ctl(dev, bearer, qos);
+	else if (dfc_pacing)
+		dfc_pace_check(dev, bearer, len);
 
 out:
 	spin_unlock_bh(&qos->qos_lock);
@@ -38,6 +38,7 @@
 #define FLAG_POWERSAVE_MASK 0x0010
 #define FLAG_QMAP_MASK 0x0020
 #define FLAG_PS_EXT_MASK 0x0040
+#define FLAG_PACING_MASK 0x0080
 
 #define FLAG_TO_MODE(f) ((f) & FLAG_DFC_MASK)
 
@@ -46,10 +47,12 @@
 
 #define FLAG_TO_QMAP(f) ((f) & FLAG_QMAP_MASK)
 #define FLAG_TO_PS_EXT(f) ((f) & FLAG_PS_EXT_MASK)
+#define FLAG_TO_PACING(f) ((f) & FLAG_PACING_MASK)
 
 int dfc_mode;
 int dfc_qmap;
 int dfc_ps_ext;
+int dfc_pacing;
 
 unsigned int rmnet_wq_frequency __read_mostly = 1000;
 
@@ -154,11 +157,14 @@ qmi_rmnet_clean_flow_list(struct qos_info *qos)
 	ASSERT_RTNL();
 
 	list_for_each_entry_safe(itm, fl_tmp, &qos->flow_head, list) {
+		hash_del_rcu(&itm->hnode);
 		list_del(&itm->list);
 		kfree(itm);
 	}
 
 	list_for_each_entry_safe(bearer, br_tmp, &qos->bearer_head, list) {
+		hrtimer_cancel(&bearer->pace_timer);
+		RCU_INIT_POINTER(qos->bearer_idx[bearer->bearer_id], NULL);
 		list_del(&bearer->list);
 		kfree(bearer);
 	}
@@ -166,6 +172,7 @@ qmi_rmnet_clean_flow_list(struct qos_info *qos)
 	memset(qos->mq, 0, sizeof(qos->mq));
 }
 
+/* Needs either rcu_read_lock() or qos_lock */
 struct rmnet_flow_map *
 qmi_rmnet_get_flow_map(struct qos_info *qos, u32 flow_id, int ip_type)
 {
@@ -174,26 +181,24 @@ qmi_rmnet_get_flow_map(struct qos_info *qos, u32 flow_id, int ip_type)
 	if (!qos)
 		return NULL;
 
-	list_for_each_entry(itm, &qos->flow_head, list) {
+	hash_for_each_possible_rcu(qos->flow_ht, itm, hnode,
+				   FLOW_HASH_KEY(flow_id, ip_type),
+				   lockdep_is_held(&qos->qos_lock)) {
 		if ((itm->flow_id == flow_id) && (itm->ip_type == ip_type))
 			return itm;
 	}
 	return NULL;
 }
 
+/* Needs either rcu_read_lock() or qos_lock */
 struct rmnet_bearer_map *
 qmi_rmnet_get_bearer_map(struct qos_info *qos, uint8_t bearer_id)
 {
-	struct rmnet_bearer_map *itm;
-
 	if (!qos)
 		return NULL;
 
-	list_for_each_entry(itm, &qos->bearer_head, list) {
-		if (itm->bearer_id == bearer_id)
-			return itm;
-	}
-	return NULL;
+	return rcu_dereference_check(qos->bearer_idx[bearer_id],
+				     lockdep_is_held(&qos->qos_lock));
 }
 
 static void qmi_rmnet_update_flow_map(struct rmnet_flow_map *itm,
@@ -306,7 +311,8 @@ static void qmi_rmnet_bearer_clean(struct qos_info *qos)
 		del_timer_sync(&qos->removed_bearer->watchdog);
 		qos->removed_bearer->ch_switch.timer_quit = true;
 		del_timer_sync(&qos->removed_bearer->ch_switch.guard_timer);
-		kfree(qos->removed_bearer);
+		hrtimer_cancel(&qos->removed_bearer->pace_timer);
+		kfree_rcu(qos->removed_bearer, rcu);
 		qos->removed_bearer = NULL;
 	}
 }
@@ -334,7 +340,11 @@ static struct rmnet_bearer_map *__qmi_rmnet_bearer_get(
 		timer_setup(&bearer->watchdog, qmi_rmnet_watchdog_fn, 0);
 		timer_setup(&bearer->ch_switch.guard_timer,
 			    rmnet_ll_guard_fn, 0);
+		hrtimer_init(&bearer->pace_timer, CLOCK_MONOTONIC,
+			     HRTIMER_MODE_REL_SOFT);
+		bearer->pace_timer.function = dfc_pace_timer_fn;
 		list_add(&bearer->list, &qos_info->bearer_head);
+		rcu_assign_pointer(qos_info->bearer_idx[bearer_id], bearer);
 	}
 
 	return bearer;
@@ -349,6 +359,11 @@ static void __qmi_rmnet_bearer_put(struct net_device *dev,
 	int i, j;
 
 	if (bearer && --bearer->flow_ref == 0) {
+		/* Keep a pending pace timer from reopening the mq once it
+		 * is handed to another bearer
+		 */
+		dfc_pace_release(dev, bearer, false);
+
 		for (i = 0; i < MAX_MQ_NUM; i++) {
 			mq = &qos_info->mq[i];
 			if (mq->bearer != bearer)
@@ -367,6 +382,7 @@ static void __qmi_rmnet_bearer_put(struct net_device *dev,
 		}
 
 		/* Remove from bearer map */
+		RCU_INIT_POINTER(qos_info->bearer_idx[bearer->bearer_id], NULL);
 		list_del(&bearer->list);
 		qos_info->removed_bearer = bearer;
 	}
@@ -488,6 +504,8 @@ again:
 
 	qmi_rmnet_update_flow_map(itm, &new_map);
 	list_add(&itm->list, &qos_info->flow_head);
+	hash_add_rcu(qos_info->flow_ht, &itm->hnode,
+		     FLOW_HASH_KEY(itm->flow_id, itm->ip_type));
 
 	/* Create or update bearer map */
 	bearer = __qmi_rmnet_bearer_get(qos_info, new_map.bearer_id);
@@ -540,8 +558,9 @@ qmi_rmnet_del_flow(struct net_device *dev, struct tcmsg *tcm,
 		__qmi_rmnet_bearer_put(dev, qos_info, itm->bearer, true);
 
 		/* Remove from flow map */
+		hash_del_rcu(&itm->hnode);
 		list_del(&itm->list);
-		kfree(itm);
+		kfree_rcu(itm, rcu);
 	}
 
 	if (list_empty(&qos_info->flow_head))
@@ -731,6 +750,7 @@ int qmi_rmnet_change_link(struct net_device *dev, void *port, void *tcm_pt,
 		dfc_mode = FLAG_TO_MODE(tcm->tcm_ifindex);
 		dfc_qmap = FLAG_TO_QMAP(tcm->tcm_ifindex);
 		dfc_ps_ext = FLAG_TO_PS_EXT(tcm->tcm_ifindex);
+		dfc_pacing = FLAG_TO_PACING(tcm->tcm_ifindex);
 
 		if (!DFC_SUPPORTED_MODE(dfc_mode) &&
 		    !(tcm->tcm_ifindex & FLAG_POWERSAVE_MASK))
@@ -1006,6 +1026,16 @@ static inline bool qmi_rmnet_is_tcp_ack(struct sk_buff *skb)
 	if (skb_is_tcp_pure_ack(skb))
 		return true;
 
+	/* GSO packets always carry payload */
+	if (skb_is_gso(skb))
+		return false;
+
+	/* Locally generated with payload in frags. Header only segments
+	 * such as SYN or FIN are linear and still go through the parser.
+	 */
+	if (skb->sk && skb->data_len)
+		return false;
+
 	/* Forwarded */
 	if (unlikely(_qmi_rmnet_is_tcp_ack(skb)))
 		return true;
@@ -1015,6 +1045,7 @@ static inline bool qmi_rmnet_is_tcp_ack(struct sk_buff *skb)
 
 static int qmi_rmnet_get_queue_sa(struct qos_info *qos, struct sk_buff *skb)
 {
+	struct rmnet_bearer_map *bearer;
 	struct rmnet_flow_map *itm;
 	int ip_type;
 	int txq = DEFAULT_MQ_NUM;
@@ -1029,20 +1060,21 @@ static int qmi_rmnet_get_queue_sa(struct qos_info *qos, struct sk_buff *skb)
 
 	ip_type = (skb->protocol == htons(ETH_P_IPV6)) ? AF_INET6 : AF_INET;
 
-	spin_lock_bh(&qos->qos_lock);
+	rcu_read_lock();
 
 	itm = qmi_rmnet_get_flow_map(qos, skb->mark, ip_type);
 	if (unlikely(!itm))
 		goto done;
 
 	/* Put the packet in the assigned mq except TCP ack */
-	if (likely(itm->bearer) && qmi_rmnet_is_tcp_ack(skb))
-		txq = itm->bearer->ack_mq_idx;
+	bearer = READ_ONCE(itm->bearer);
+	if (likely(bearer) && qmi_rmnet_is_tcp_ack(skb))
+		txq = READ_ONCE(bearer->ack_mq_idx);
 	else
-		txq = itm->mq_idx;
+		txq = READ_ONCE(itm->mq_idx);
 
 done:
-	spin_unlock_bh(&qos->qos_lock);
+	rcu_read_unlock();
 	return txq;
 }
 
@@ -1061,13 +1093,13 @@ int qmi_rmnet_get_queue(struct net_device *dev, struct sk_buff *skb)
 
 	ip_type = (skb->protocol == htons(ETH_P_IPV6)) ? AF_INET6 : AF_INET;
 
-	spin_lock_bh(&qos->qos_lock);
+	rcu_read_lock();
 
 	itm = qmi_rmnet_get_flow_map(qos, mark, ip_type);
 	if (itm)
-		txq = itm->mq_idx;
+		txq = READ_ONCE(itm->mq_idx);
 
-	spin_unlock_bh(&qos->qos_lock);
+	rcu_read_unlock();
 
 	return txq;
 }
@@ -1094,6 +1126,7 @@ void *qmi_rmnet_qos_init(struct net_device *real_dev,
 	qos->tran_num = 0;
 	INIT_LIST_HEAD(&qos->flow_head);
 	INIT_LIST_HEAD(&qos->bearer_head);
+	hash_init(qos->flow_ht);
 	spin_lock_init(&qos->qos_lock);
 
 	return qos;
@@ -1113,8 +1146,12 @@ void qmi_rmnet_qos_exit_pre(void *qos)
 		del_timer_sync(&bearer->watchdog);
 		bearer->ch_switch.timer_quit = true;
 		del_timer_sync(&bearer->ch_switch.guard_timer);
+		hrtimer_cancel(&bearer->pace_timer);
 	}
 
+	if (qosi->removed_bearer)
+		hrtimer_cancel(&qosi->removed_bearer->pace_timer);
+
 	list_add(&qosi->list, &qos_cleanup_list);
 }
 EXPORT_SYMBOL(qmi_rmnet_qos_exit_pre);
@@ -18,6 +18,8 @@
 #include <linux/netdevice.h>
 #include <linux/skbuff.h>
 #include <linux/timer.h>
+#include <linux/hrtimer.h>
+#include <linux/hashtable.h>
 #include <uapi/linux/rtnetlink.h>
 #include <linux/soc/qcom/qmi.h>
 
@@ -30,6 +32,9 @@
 #define DEFAULT_MQ_NUM 0
 #define ACK_MQ_OFFSET (MAX_MQ_NUM - 1)
 #define INVALID_MQ 0xFF
+#define MAX_BEARER_ID 256
+#define FLOW_HASH_BITS 6
+#define FLOW_HASH_KEY(flow_id, ip_type) ((flow_id) ^ (u32)(ip_type))
 
 #define DFC_MODE_SA 4
 #define PS_MAX_BEARERS 32
@@ -40,6 +45,7 @@
 
 extern int dfc_mode;
 extern int dfc_qmap;
+extern int dfc_pacing;
 
 struct qos_info;
 
@@ -96,10 +102,20 @@ struct rmnet_bearer_map {
 	bool watchdog_quit;
 	u32 watchdog_expire_cnt;
 	struct rmnet_ch_switch ch_switch;
+	/* Grant pacing */
+	u32 pace_rate;
+	u32 pace_sent;
+	ktime_t pace_last_ind;
+	ktime_t pace_next;
+	bool pace_stopped;
+	struct hrtimer pace_timer;
+	struct rcu_head rcu;
 };
 
 struct rmnet_flow_map {
 	struct list_head list;
+	struct hlist_node hnode;
+	struct rcu_head rcu;
 	u8 bearer_id;
 	u32 flow_id;
 	int ip_type;
@@ -126,6 +142,11 @@ struct qos_info {
 	struct net_device *vnd_dev;
 	struct list_head flow_head;
 	struct list_head bearer_head;
+	/* Lookup indexes for the lists above. Updated under qos_lock,
+	 * readable under RCU.
+	 */
+	DECLARE_HASHTABLE(flow_ht, FLOW_HASH_BITS);
+	struct rmnet_bearer_map __rcu *bearer_idx[MAX_BEARER_ID];
 	struct mq_map mq[MAX_MQ_NUM];
 	u32 tran_num;
 	spinlock_t qos_lock;
@@ -206,6 +227,11 @@ void qmi_rmnet_watchdog_add(struct rmnet_bearer_map *bearer);
 
 void qmi_rmnet_watchdog_remove(struct rmnet_bearer_map *bearer);
 
+enum hrtimer_restart dfc_pace_timer_fn(struct hrtimer *t);
+
+void dfc_pace_release(struct net_device *dev,
+		      struct rmnet_bearer_map *bearer, bool wake);
+
 int rmnet_ll_switch(struct net_device *dev, struct tcmsg *tcm, int attrlen);
 void rmnet_ll_guard_fn(struct timer_list *t);
 void rmnet_ll_wq_init(void);
@@ -169,6 +169,13 @@ struct rmnet_pcpu_stats {
 	struct u64_stats_sync syncp;
 };
 
+/* Updated under the TX queue lock, so one instance per queue suffices */
+struct rmnet_txq_stats {
+	u64 tx_pkts;
+	u64 tx_bytes;
+	struct u64_stats_sync syncp;
+};
+
 struct rmnet_coal_close_stats {
 	u64 non_coal;
 	u64 ip_miss;
@@ -225,6 +232,7 @@ struct rmnet_priv {
 	u8 mux_id;
 	struct net_device *real_dev;
 	struct rmnet_pcpu_stats __percpu *pcpu_stats;
+	struct rmnet_txq_stats *txq_stats;
 	struct gro_cells gro_cells;
 	struct rmnet_priv_stats stats;
 	void __rcu *qos_info;
@@ -74,6 +74,24 @@ void rmnet_vnd_tx_fixup(struct net_device *dev, u32 skb_len)
 	u64_stats_update_end(&pcpu_ptr->syncp);
 }
 
+static void rmnet_vnd_txq_stats_update(struct net_device *dev,
+				       struct sk_buff *skb)
+{
+	struct rmnet_priv *priv = netdev_priv(dev);
+	struct rmnet_txq_stats *txq_stats;
+	u16 txq = skb_get_queue_mapping(skb);
+
+	if (unlikely(!priv->txq_stats || txq >= dev->num_tx_queues))
+		return;
+
+	txq_stats = &priv->txq_stats[txq];
+
+	u64_stats_update_begin(&txq_stats->syncp);
+	txq_stats->tx_pkts++;
+	txq_stats->tx_bytes += skb->len;
+	u64_stats_update_end(&txq_stats->syncp);
+}
+
 /* Network Device Operations */
 
 static netdev_tx_t rmnet_vnd_start_xmit(struct sk_buff *skb,
@@ -89,6 +107,7 @@ static netdev_tx_t rmnet_vnd_start_xmit(struct sk_buff *skb,
 
 	priv = netdev_priv(dev);
 	if (priv->real_dev) {
+		rmnet_vnd_txq_stats_update(dev, skb);
 		ip_type = (ip_hdr(skb)->version == 4) ?
 					AF_INET : AF_INET6;
 		mark = skb->mark;
@@ -204,14 +223,26 @@ static int rmnet_vnd_get_iflink(const struct net_device *dev)
 static int rmnet_vnd_init(struct net_device *dev)
 {
 	struct rmnet_priv *priv = netdev_priv(dev);
+	unsigned int i;
 	int err;
 
 	priv->pcpu_stats = alloc_percpu(struct rmnet_pcpu_stats);
 	if (!priv->pcpu_stats)
 		return -ENOMEM;
 
+	priv->txq_stats = kcalloc(dev->num_tx_queues,
+				  sizeof(*priv->txq_stats), GFP_KERNEL);
+	if (!priv->txq_stats) {
+		free_percpu(priv->pcpu_stats);
+		return -ENOMEM;
+	}
+
+	for (i = 0; i < dev->num_tx_queues; i++)
+		u64_stats_init(&priv->txq_stats[i].syncp);
+
 	err = gro_cells_init(&priv->gro_cells, dev);
 	if (err) {
+		kfree(priv->txq_stats);
 		free_percpu(priv->pcpu_stats);
 		return err;
 	}
@@ -226,6 +257,8 @@ static void rmnet_vnd_uninit(struct net_device *dev)
 
 	gro_cells_destroy(&priv->gro_cells);
 	free_percpu(priv->pcpu_stats);
+	kfree(priv->txq_stats);
+	priv->txq_stats = NULL;
 
 	qos = rcu_dereference(priv->qos_info);
 	RCU_INIT_POINTER(priv->qos_info, NULL);
@@ -425,8 +458,15 @@ skip_trace_print_udp_tx:
 	}
 
 skip_trace:
-	if (priv->real_dev)
-		txq = qmi_rmnet_get_queue(dev, skb);
+	if (priv->real_dev) {
+		/* Without DFC the queues carry no bearer meaning, so spread
+		 * the flows across them using the XPS map set up at newlink.
+		 */
+		if (rmnet_get_qmi_pt(rmnet_get_rmnet_port(dev)))
+			txq = qmi_rmnet_get_queue(dev, skb);
+		else if (dev->real_num_tx_queues > 1)
+			txq = netdev_pick_tx(dev, skb, sb_dev);
+	}
 
 	if (rmnet_core_userspace_connected) {
 		rmnet_update_pid_and_check_boost(task_pid_nr(current),
@@ -566,6 +606,7 @@ static const char rmnet_qmap_gstrings_stats[][ETH_GSTRING_LEN] = {
 static void rmnet_get_strings(struct net_device *dev, u32 stringset, u8 *buf)
 {
 	size_t off = 0;
+	unsigned int i;
 
 	switch (stringset) {
 	case ETH_SS_STATS:
@@ -581,6 +622,15 @@ static void rmnet_get_strings(struct net_device *dev, u32 stringset, u8 *buf)
 		off += sizeof(rmnet_ll_gstrings_stats);
 		memcpy(buf + off, &rmnet_qmap_gstrings_stats,
 		       sizeof(rmnet_qmap_gstrings_stats));
+		off += sizeof(rmnet_qmap_gstrings_stats);
+		for (i = 0; i < dev->num_tx_queues; i++) {
+			snprintf(buf + off, ETH_GSTRING_LEN,
+				 "TXQ%u packets", i);
+			off += ETH_GSTRING_LEN;
+			snprintf(buf + off, ETH_GSTRING_LEN,
+				 "TXQ%u bytes", i);
+			off += ETH_GSTRING_LEN;
+		}
 		break;
 	}
 }
@@ -592,7 +642,8 @@ static int rmnet_get_sset_count(struct net_device *dev, int sset)
 		return ARRAY_SIZE(rmnet_gstrings_stats) +
 		       ARRAY_SIZE(rmnet_port_gstrings_stats) +
 		       ARRAY_SIZE(rmnet_ll_gstrings_stats) +
-		       ARRAY_SIZE(rmnet_qmap_gstrings_stats);
+		       ARRAY_SIZE(rmnet_qmap_gstrings_stats) +
+		       2 * dev->num_tx_queues;
 	default:
 		return -EOPNOTSUPP;
 	}
@@ -605,9 +656,11 @@ static void rmnet_get_ethtool_stats(struct net_device *dev,
 	struct rmnet_priv_stats *st = &priv->stats;
 	struct rmnet_port_priv_stats *stp;
 	struct rmnet_ll_stats *llp;
+	struct rmnet_txq_stats *txq_stats;
 	struct rmnet_port *port;
 	size_t off = 0;
 	u64 qmap_s[ARRAY_SIZE(rmnet_qmap_gstrings_stats)];
+	unsigned int i, start;
 
 	port = rmnet_get_port(priv->real_dev);
 
@@ -630,6 +683,23 @@ static void rmnet_get_ethtool_stats(struct net_device *dev,
 	rmnet_ctl_get_stats(qmap_s, ARRAY_SIZE(rmnet_qmap_gstrings_stats));
 	memcpy(data + off, qmap_s,
 	       ARRAY_SIZE(rmnet_qmap_gstrings_stats) * sizeof(u64));
+
+	off += ARRAY_SIZE(rmnet_qmap_gstrings_stats);
+	for (i = 0; i < dev->num_tx_queues; i++) {
+		data[off] = 0;
+		data[off + 1] = 0;
+		if (priv->txq_stats) {
+			txq_stats = &priv->txq_stats[i];
+			do {
+				start = u64_stats_fetch_begin_irq(
+						&txq_stats->syncp);
+				data[off] = txq_stats->tx_pkts;
+				data[off + 1] = txq_stats->tx_bytes;
+			} while (u64_stats_fetch_retry_irq(&txq_stats->syncp,
+							   start));
+		}
+		off += 2;
+	}
 }
 
 static int rmnet_stats_reset(struct net_device *dev)
@@ -682,6 +752,37 @@ void rmnet_vnd_setup(struct net_device *rmnet_dev)
 	rmnet_dev->ethtool_ops = &rmnet_ethtool_ops;
 }
 
+/* Spread the CPUs over the TX queues so that each core transmits on its
+ * own queue when the queue is not chosen by DFC.
+ */
+static void rmnet_vnd_set_xps(struct net_device *dev)
+{
+#ifdef CONFIG_XPS
+	cpumask_var_t mask;
+	unsigned int cpu;
+	u16 txq;
+
+	if (dev->real_num_tx_queues <= 1)
+		return;
+
+	if (!zalloc_cpumask_var(&mask, GFP_KERNEL))
+		return;
+
+	for (txq = 0; txq < dev->real_num_tx_queues; txq++) {
+		cpumask_clear(mask);
+		for_each_possible_cpu(cpu) {
+			if (cpu % dev->real_num_tx_queues == txq)
+				cpumask_set_cpu(cpu, mask);
+		}
+
+		if (!cpumask_empty(mask))
+			netif_set_xps_queue(dev, mask, txq);
+	}
+
+	free_cpumask_var(mask);
+#endif
+}
+
 /* Exposed API */
 
 int rmnet_vnd_newlink(u8 id, struct net_device *rmnet_dev,
@@ -720,6 +821,7 @@ int rmnet_vnd_newlink(u8 id, struct net_device *rmnet_dev,
 		priv->mux_id = id;
 		rcu_assign_pointer(priv->qos_info,
 			qmi_rmnet_qos_init(real_dev, rmnet_dev, id));
+		rmnet_vnd_set_xps(rmnet_dev);
 
 		netdev_dbg(rmnet_dev, "rmnet dev created\n");
 	}
@@ -749,14 +851,28 @@ u8 rmnet_vnd_get_mux(struct net_device *rmnet_dev)
 int rmnet_vnd_do_flow_control(struct net_device *rmnet_dev, int enable)
 {
 	netdev_dbg(rmnet_dev, "Setting VND TX queue state to %d\n", enable);
+
+	/* With DFC the queues map to bearers and DFC owns their state, so
+	 * only queue 0 follows the MAP command as before. Without DFC the
+	 * queues are just XPS spread of the same flows and move together.
+	 */
+	if (rmnet_get_qmi_pt(rmnet_get_rmnet_port(rmnet_dev))) {
+		if (unlikely(enable))
+			netif_wake_queue(rmnet_dev);
+		else
+			netif_stop_queue(rmnet_dev);
+
+		return 0;
+	}
+
 	/* Although we expect similar number of enable/disable
 	 * commands, optimize for the disable. That is more
 	 * latency sensitive than enable
 	 */
 	if (unlikely(enable))
-		netif_wake_queue(rmnet_dev);
+		netif_tx_wake_all_queues(rmnet_dev);
 	else
-		netif_stop_queue(rmnet_dev);
+		netif_tx_stop_all_queues(rmnet_dev);
 
 	return 0;
 }
@@ -928,15 +928,20 @@ struct cdp_delay_rx_stats {
  * struct cdp_delay_tid_stats: Delay tid stats
  * @tx_delay: Tx delay related stats
  * @rx_delay: Rx delay related stats
+ *
+ * Each instance is written by a single Tx completion or Rx ring context.
+ * Tx and Rx halves sit on their own cachelines so neighbouring rings and
+ * the opposite direction never write to a shared line.
  */
 struct cdp_delay_tid_stats {
-	struct cdp_delay_tx_stats  tx_delay;
-	struct cdp_delay_rx_stats  rx_delay;
+	struct cdp_delay_tx_stats  tx_delay qdf_cacheline_aligned;
+	struct cdp_delay_rx_stats  rx_delay qdf_cacheline_aligned;
 };
 
 /*
  * cdp_peer_ext_stats: Peer extended stats
- * @delay_stats: Per TID delay stats
+ * @delay_stats: Per TID, per ring context delay stats; merged into a single
+ *	histogram only when the stats are read
  */
 struct cdp_peer_ext_stats {
 	struct cdp_delay_tid_stats delay_stats[CDP_MAX_DATA_TIDS]
@@ -2363,6 +2368,10 @@ struct cdp_pdev_stats {
 	struct {
 		uint64_t num_bufs_refilled;
 		uint64_t num_bufs_allocated;
+		uint64_t num_underrun;
+		uint64_t num_alloc_fail;
+		uint32_t refill_time_last_us;
+		uint32_t refill_time_max_us;
 	} rx_refill_buff_pool;
 
 	uint32_t peer_unauth_rx_pkt_drop;
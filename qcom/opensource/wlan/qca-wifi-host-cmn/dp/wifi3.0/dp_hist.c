@@ -22,7 +22,13 @@
 #include "dp_hist.h"
 
 /*
- * dp_hist_sw_enq_dbucket: Sofware enqueue delay bucket in ms
+ * All delay histograms use CDP_HIST_BUCKET_MAX equal width buckets starting
+ * at 0 ms, with the last bucket open ended, so the bucket index is computed
+ * rather than searched for.
+ */
+
+/*
+ * DP_HIST_SW_ENQ_DBUCKET_MS: Sofware enqueue delay bucket width in ms
  * @index_0 = 0_1 ms
  * @index_1 = 1_2 ms
  * @index_2 = 2_3 ms
@@ -32,13 +38,12 @@
  * @index_6 = 6_7 ms
  * @index_7 = 7_8 ms
  * @index_8 = 8_9 ms
- * @index_8 = 9+ ms
+ * @index_9 = 9+ ms
  */
-static uint16_t dp_hist_sw_enq_dbucket[CDP_HIST_BUCKET_MAX] = {
-	0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+#define DP_HIST_SW_ENQ_DBUCKET_MS 1
 
 /*
- * cdp_hist_fw2hw_dbucket: HW enqueue to Completion Delay
+ * DP_HIST_FW2HW_DBUCKET_MS: HW enqueue to Completion Delay bucket width in ms
  * @index_0 = 0_10 ms
  * @index_1 = 10_20 ms
  * @index_2 = 20_30ms
@@ -50,11 +55,10 @@ static uint16_t dp_hist_sw_enq_dbucket[CDP_HIST_BUCKET_MAX] = {
  * @index_8 = 80_90 ms
  * @index_9 = 90+ ms
  */
-static uint16_t dp_hist_fw2hw_dbucket[CDP_HIST_BUCKET_MAX] = {
-	0, 10, 20, 30, 40, 50, 60, 70, 80, 90};
+#define DP_HIST_FW2HW_DBUCKET_MS 10
 
 /*
- * dp_hist_reap2stack_bucket: Reap to stack bucket
+ * DP_HIST_REAP2STACK_DBUCKET_MS: Reap to stack bucket width in ms
  * @index_0 = 0_5 ms
  * @index_1 = 5_10 ms
  * @index_2 = 10_15 ms
@@ -66,24 +70,26 @@ static uint16_t dp_hist_fw2hw_dbucket[CDP_HIST_BUCKET_MAX] = {
  * @index_8 = 40_45 ms
  * @index_9 = 45+ ms
  */
-static uint16_t dp_hist_reap2stack_bucket[CDP_HIST_BUCKET_MAX] = {
-	0, 5, 10, 15, 20, 25, 30, 35, 40, 45};
+#define DP_HIST_REAP2STACK_DBUCKET_MS 5
 
 /*
  * dp_hist_find_bucket_idx: Find the bucket index
- * @bucket_array: Bucket array
  * @value: Frequency value
+ * @width: Bucket width; a constant at every call site so the division is
+ *	strength reduced by the compiler
  *
  * Return: The bucket index
  */
-static int dp_hist_find_bucket_idx(int16_t *bucket_array, int value)
+static inline int dp_hist_find_bucket_idx(int value, const int width)
 {
-	uint8_t idx = CDP_HIST_BUCKET_0;
+	int idx;
 
-	for (; idx < (CDP_HIST_BUCKET_MAX - 1); idx++) {
-		if (value < bucket_array[idx + 1])
-			break;
-	}
+	if (qdf_unlikely(value < 0))
+		return CDP_HIST_BUCKET_0;
+
+	idx = value / width;
+	if (idx >= CDP_HIST_BUCKET_MAX)
+		idx = CDP_HIST_BUCKET_MAX - 1;
 
 	return idx;
 }
@@ -108,16 +114,16 @@ static void dp_hist_fill_buckets(struct cdp_hist_bucket *hist_bucket, int value)
 	/* Identify the bucket the bucket and update. */
 	switch (hist_type) {
 	case CDP_HIST_TYPE_SW_ENQEUE_DELAY:
-		idx =  dp_hist_find_bucket_idx(&dp_hist_sw_enq_dbucket[0],
-					       value);
+		idx = dp_hist_find_bucket_idx(value,
+					      DP_HIST_SW_ENQ_DBUCKET_MS);
 		break;
 	case CDP_HIST_TYPE_HW_COMP_DELAY:
-		idx =  dp_hist_find_bucket_idx(&dp_hist_fw2hw_dbucket[0],
-					       value);
+		idx = dp_hist_find_bucket_idx(value,
+					      DP_HIST_FW2HW_DBUCKET_MS);
 		break;
 	case CDP_HIST_TYPE_REAP_STACK:
-		idx =  dp_hist_find_bucket_idx(
-				&dp_hist_reap2stack_bucket[0], value);
+		idx = dp_hist_find_bucket_idx(value,
+					      DP_HIST_REAP2STACK_DBUCKET_MS);
 		break;
 	default:
 		break;
@@ -129,6 +135,23 @@ static void dp_hist_fill_buckets(struct cdp_hist_bucket *hist_bucket, int value)
 	hist_bucket->freq[idx]++;
 }
 
+/*
+ * dp_hist_has_samples: Check if any sample was recorded in the histogram
+ * @hist_stats: Hist stats object
+ *
+ * Return: true if at least one bucket is non-zero
+ */
+static bool dp_hist_has_samples(struct cdp_hist_stats *hist_stats)
+{
+	uint8_t index;
+
+	for (index = 0; index < CDP_HIST_BUCKET_MAX; index++)
+		if (hist_stats->hist.freq[index])
+			return true;
+
+	return false;
+}
+
 /*
  * dp_hist_update_stats: Update histogram stats
  * @hist_stats: Hist stats object
@@ -175,6 +198,9 @@ void dp_copy_hist_stats(struct cdp_hist_stats *src_hist_stats,
 {
 	uint8_t index;
 
+	if (!dp_hist_has_samples(src_hist_stats))
+		return;
+
 	for (index = 0; index < CDP_HIST_BUCKET_MAX; index++)
 		dst_hist_stats->hist.freq[index] =
 			src_hist_stats->hist.freq[index];
@@ -188,6 +214,9 @@ void dp_copy_hist_stats(struct cdp_hist_stats *src_hist_stats,
  * @src_hist_stats: Source histogram stats
  * @dst_hist_stats: Destination histogram stats
  *
+ * Ring contexts that saw no samples are skipped, so they do not pull the
+ * merged min and average towards zero.
+ *
  * Return: void
  */
 void dp_accumulate_hist_stats(struct cdp_hist_stats *src_hist_stats,
@@ -195,6 +224,14 @@ void dp_accumulate_hist_stats(struct cdp_hist_stats *src_hist_stats,
 {
 	uint8_t index;
 
+	if (!dp_hist_has_samples(src_hist_stats))
+		return;
+
+	if (!dp_hist_has_samples(dst_hist_stats)) {
+		dp_copy_hist_stats(src_hist_stats, dst_hist_stats);
+		return;
+	}
+
 	for (index = 0; index < CDP_HIST_BUCKET_MAX; index++)
 		dst_hist_stats->hist.freq[index] +=
 			src_hist_stats->hist.freq[index];
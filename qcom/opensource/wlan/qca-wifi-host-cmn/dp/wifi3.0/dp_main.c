@@ -7876,6 +7876,19 @@ free_vdev:
 
 qdf_export_symbol(dp_vdev_unref_delete);
 
+/*
+ * dp_peer_free_rcu() - free peer memory once no hash reader can see it
+ * @head: rcu head embedded in the peer
+ *
+ * Return: None
+ */
+static void dp_peer_free_rcu(qdf_rcu_head_t *head)
+{
+	struct dp_peer *peer = qdf_container_of(head, struct dp_peer, rcu);
+
+	qdf_mem_free(peer);
+}
+
 /*
  * dp_peer_unref_delete() - unref and delete peer
  * @peer_handle:    Datapath peer handle
@@ -7961,7 +7974,11 @@ void dp_peer_unref_delete(struct dp_peer *peer, enum dp_mod_id mod_id)
 		dp_monitor_peer_detach(soc, peer);
 
 		qdf_spinlock_destroy(&peer->peer_state_lock);
-		qdf_mem_free(peer);
+		/*
+		 * dp_peer_find_hash_find() walks the hash bins without
+		 * a lock, defer the free past readers still on this peer
+		 */
+		qdf_call_rcu(&peer->rcu, dp_peer_free_rcu);
 
 		/*
 		 * Decrement ref count taken at peer create
@@ -228,6 +228,117 @@ dp_peer_find_hash_index(struct dp_soc *soc,
 	return index;
 }
 
+/*
+ * The link peer hash bins are singly linked chains walked by
+ * dp_peer_find_hash_find() under qdf_rcu_read_lock() only. Updates are
+ * serialized by peer_hash_lock, and a peer is freed only after an RCU
+ * grace period (see dp_peer_unref_delete()), so a reader may keep walking
+ * from a peer that was just unlinked.
+ */
+#define dp_peer_hash_bin_for_each(_peer, _soc, _index) \
+	for (_peer = qdf_rcu_dereference((_soc)->peer_hash.bins[_index]); \
+	     _peer; _peer = qdf_rcu_dereference((_peer)->hash_next))
+
+#define dp_peer_hash_bin_for_each_locked(_peer, _soc, _index) \
+	for (_peer = qdf_rcu_dereference_protected( \
+				(_soc)->peer_hash.bins[_index]); \
+	     _peer; \
+	     _peer = qdf_rcu_dereference_protected((_peer)->hash_next))
+
+/*
+ * dp_peer_hash_bin_add() - append peer to a peer_hash bin
+ * @soc: soc handle
+ * @index: bin index
+ * @peer: peer handle
+ *
+ * Caller must hold peer_hash_lock.
+ *
+ * return: none
+ */
+static void dp_peer_hash_bin_add(struct dp_soc *soc, uint32_t index,
+				 struct dp_peer *peer)
+{
+	struct dp_peer **pprev = &soc->peer_hash.bins[index];
+	struct dp_peer *tmppeer;
+
+	while ((tmppeer = qdf_rcu_dereference_protected(*pprev)))
+		pprev = &tmppeer->hash_next;
+
+	peer->hash_next = NULL;
+	qdf_rcu_assign_pointer(*pprev, peer);
+}
+
+/*
+ * dp_peer_hash_bin_remove() - unlink peer from a peer_hash bin
+ * @soc: soc handle
+ * @index: bin index
+ * @peer: peer handle
+ *
+ * Caller must hold peer_hash_lock. peer->hash_next is left intact for
+ * readers still walking the chain.
+ *
+ * return: true if the peer was found in the bin
+ */
+static bool dp_peer_hash_bin_remove(struct dp_soc *soc, uint32_t index,
+				    struct dp_peer *peer)
+{
+	struct dp_peer **pprev = &soc->peer_hash.bins[index];
+	struct dp_peer *tmppeer;
+
+	while ((tmppeer = qdf_rcu_dereference_protected(*pprev))) {
+		if (tmppeer == peer) {
+			qdf_rcu_assign_pointer(*pprev, peer->hash_next);
+			return true;
+		}
+		pprev = &tmppeer->hash_next;
+	}
+
+	return false;
+}
+
+/*
+ * dp_peer_hash_bin_find() - lockless lookup of a link peer in peer_hash
+ * @soc: soc handle
+ * @mac_addr: aligned peer mac address
+ * @vdev_id: vdev_id or DP_VDEV_ALL
+ * @mod_id: id of module requesting reference
+ *
+ * The reference is taken before the vdev is looked at, the peer may
+ * otherwise be freed along with its vdev once unlinked.
+ *
+ * return: peer with a reference held on success
+ *         NULL on failure
+ */
+static struct dp_peer *dp_peer_hash_bin_find(struct dp_soc *soc,
+					     union dp_align_mac_addr *mac_addr,
+					     uint8_t vdev_id,
+					     enum dp_mod_id mod_id)
+{
+	uint32_t index = dp_peer_find_hash_index(soc, mac_addr);
+	struct dp_peer *peer;
+
+	qdf_rcu_read_lock();
+	dp_peer_hash_bin_for_each(peer, soc, index) {
+		if (dp_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr))
+			continue;
+
+		/* peer is being deleted */
+		if (dp_peer_get_ref(soc, peer, mod_id) != QDF_STATUS_SUCCESS)
+			continue;
+
+		if ((peer->vdev->vdev_id == vdev_id) ||
+		    (vdev_id == DP_VDEV_ALL)) {
+			qdf_rcu_read_unlock();
+			return peer;
+		}
+
+		dp_peer_unref_delete(peer, mod_id);
+	}
+	qdf_rcu_read_unlock();
+
+	return NULL;
+}
+
 #ifdef WLAN_FEATURE_11BE_MLO
 /*
  * dp_peer_find_hash_detach() - cleanup memory for peer_hash table
@@ -238,6 +349,8 @@ dp_peer_find_hash_index(struct dp_soc *soc,
 static void dp_peer_find_hash_detach(struct dp_soc *soc)
 {
 	if (soc->peer_hash.bins) {
+		/* wait for the deferred frees of peers erased from the hash */
+		qdf_rcu_barrier();
 		qdf_mem_free(soc->peer_hash.bins);
 		soc->peer_hash.bins = NULL;
 		qdf_spinlock_destroy(&soc->peer_hash_lock);
@@ -255,7 +368,7 @@ static void dp_peer_find_hash_detach(struct dp_soc *soc)
  */
 static QDF_STATUS dp_peer_find_hash_attach(struct dp_soc *soc)
 {
-	int i, hash_elems, log2;
+	int hash_elems, log2;
 
 	/* allocate the peer MAC address -> peer object hash table */
 	hash_elems = soc->max_peers;
@@ -266,15 +379,12 @@ static QDF_STATUS dp_peer_find_hash_attach(struct dp_soc *soc)
 
 	soc->peer_hash.mask = hash_elems - 1;
 	soc->peer_hash.idx_bits = log2;
-	/* allocate an array of TAILQ peer object lists */
+	/* allocate an array of peer chain heads, zeroed to empty bins */
 	soc->peer_hash.bins = qdf_mem_malloc(
-		hash_elems * sizeof(TAILQ_HEAD(anonymous_tail_q, dp_peer)));
+		hash_elems * sizeof(*soc->peer_hash.bins));
 	if (!soc->peer_hash.bins)
 		return QDF_STATUS_E_NOMEM;
 
-	for (i = 0; i < hash_elems; i++)
-		TAILQ_INIT(&soc->peer_hash.bins[i]);
-
 	qdf_spinlock_create(&soc->peer_hash_lock);
 
 	if (soc->arch_ops.mlo_peer_find_hash_attach &&
@@ -317,8 +427,7 @@ void dp_peer_find_hash_add(struct dp_soc *soc, struct dp_peer *peer)
 		 * this ensures that if two entries with the same MAC address
 		 * are stored, the one added first will be found first.
 		 */
-		TAILQ_INSERT_TAIL(&soc->peer_hash.bins[index], peer,
-				  hash_list_elem);
+		dp_peer_hash_bin_add(soc, index, peer);
 
 		qdf_spin_unlock_bh(&soc->peer_hash_lock);
 	} else if (peer->peer_type == CDP_MLD_PEER_TYPE) {
@@ -348,7 +457,6 @@ struct dp_peer *dp_peer_find_hash_find(struct dp_soc *soc,
 				       enum dp_mod_id mod_id)
 {
 	union dp_align_mac_addr local_mac_addr_aligned, *mac_addr;
-	unsigned index;
 	struct dp_peer *peer;
 
 	if (!soc->peer_hash.bins)
@@ -363,22 +471,9 @@ struct dp_peer *dp_peer_find_hash_find(struct dp_soc *soc,
 		mac_addr = &local_mac_addr_aligned;
 	}
 	/* search link peer table firstly */
-	index = dp_peer_find_hash_index(soc, mac_addr);
-	qdf_spin_lock_bh(&soc->peer_hash_lock);
-	TAILQ_FOREACH(peer, &soc->peer_hash.bins[index], hash_list_elem) {
-		if (dp_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr) == 0 &&
-		    ((peer->vdev->vdev_id == vdev_id) ||
-		     (vdev_id == DP_VDEV_ALL))) {
-			/* take peer reference before returning */
-			if (dp_peer_get_ref(soc, peer, mod_id) !=
-						QDF_STATUS_SUCCESS)
-				peer = NULL;
-
-			qdf_spin_unlock_bh(&soc->peer_hash_lock);
-			return peer;
-		}
-	}
-	qdf_spin_unlock_bh(&soc->peer_hash_lock);
+	peer = dp_peer_hash_bin_find(soc, mac_addr, vdev_id, mod_id);
+	if (peer)
+		return peer;
 
 	if (soc->arch_ops.mlo_peer_find_hash_find)
 		return soc->arch_ops.mlo_peer_find_hash_find(soc, peer_mac_addr,
@@ -399,26 +494,14 @@ qdf_export_symbol(dp_peer_find_hash_find);
 void dp_peer_find_hash_remove(struct dp_soc *soc, struct dp_peer *peer)
 {
 	unsigned index;
-	struct dp_peer *tmppeer = NULL;
-	int found = 0;
+	bool found;
 
 	index = dp_peer_find_hash_index(soc, &peer->mac_addr);
 
 	if (peer->peer_type == CDP_LINK_PEER_TYPE) {
-		/* Check if tail is not empty before delete*/
-		QDF_ASSERT(!TAILQ_EMPTY(&soc->peer_hash.bins[index]));
-
 		qdf_spin_lock_bh(&soc->peer_hash_lock);
-		TAILQ_FOREACH(tmppeer, &soc->peer_hash.bins[index],
-			      hash_list_elem) {
-			if (tmppeer == peer) {
-				found = 1;
-				break;
-			}
-		}
+		found = dp_peer_hash_bin_remove(soc, index, peer);
 		QDF_ASSERT(found);
-		TAILQ_REMOVE(&soc->peer_hash.bins[index], peer,
-			     hash_list_elem);
 
 		dp_peer_unref_delete(peer, DP_MOD_ID_CONFIG);
 		qdf_spin_unlock_bh(&soc->peer_hash_lock);
@@ -460,7 +543,7 @@ static bool dp_peer_exist_on_pdev(struct dp_soc *soc,
 	}
 	index = dp_peer_find_hash_index(soc, mac_addr);
 	qdf_spin_lock_bh(&soc->peer_hash_lock);
-	TAILQ_FOREACH(peer, &soc->peer_hash.bins[index], hash_list_elem) {
+	dp_peer_hash_bin_for_each_locked(peer, soc, index) {
 		if (dp_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr) == 0 &&
 		    (peer->vdev->pdev == pdev)) {
 			found = true;
@@ -474,7 +557,7 @@ static bool dp_peer_exist_on_pdev(struct dp_soc *soc,
 #else
 static QDF_STATUS dp_peer_find_hash_attach(struct dp_soc *soc)
 {
-	int i, hash_elems, log2;
+	int hash_elems, log2;
 
 	/* allocate the peer MAC address -> peer object hash table */
 	hash_elems = soc->max_peers;
@@ -485,15 +568,12 @@ static QDF_STATUS dp_peer_find_hash_attach(struct dp_soc *soc)
 
 	soc->peer_hash.mask = hash_elems - 1;
 	soc->peer_hash.idx_bits = log2;
-	/* allocate an array of TAILQ peer object lists */
+	/* allocate an array of peer chain heads, zeroed to empty bins */
 	soc->peer_hash.bins = qdf_mem_malloc(
-		hash_elems * sizeof(TAILQ_HEAD(anonymous_tail_q, dp_peer)));
+		hash_elems * sizeof(*soc->peer_hash.bins));
 	if (!soc->peer_hash.bins)
 		return QDF_STATUS_E_NOMEM;
 
-	for (i = 0; i < hash_elems; i++)
-		TAILQ_INIT(&soc->peer_hash.bins[i]);
-
 	qdf_spinlock_create(&soc->peer_hash_lock);
 	return QDF_STATUS_SUCCESS;
 }
@@ -501,6 +581,8 @@ static QDF_STATUS dp_peer_find_hash_attach(struct dp_soc *soc)
 static void dp_peer_find_hash_detach(struct dp_soc *soc)
 {
 	if (soc->peer_hash.bins) {
+		/* wait for the deferred frees of peers erased from the hash */
+		qdf_rcu_barrier();
 		qdf_mem_free(soc->peer_hash.bins);
 		soc->peer_hash.bins = NULL;
 		qdf_spinlock_destroy(&soc->peer_hash_lock);
@@ -528,7 +610,7 @@ void dp_peer_find_hash_add(struct dp_soc *soc, struct dp_peer *peer)
 	 * the same MAC address are stored, the one added first will be
 	 * found first.
 	 */
-	TAILQ_INSERT_TAIL(&soc->peer_hash.bins[index], peer, hash_list_elem);
+	dp_peer_hash_bin_add(soc, index, peer);
 
 	qdf_spin_unlock_bh(&soc->peer_hash_lock);
 }
@@ -539,8 +621,6 @@ struct dp_peer *dp_peer_find_hash_find(
 				enum dp_mod_id mod_id)
 {
 	union dp_align_mac_addr local_mac_addr_aligned, *mac_addr;
-	unsigned index;
-	struct dp_peer *peer;
 
 	if (!soc->peer_hash.bins)
 		return NULL;
@@ -553,23 +633,7 @@ struct dp_peer *dp_peer_find_hash_find(
 			peer_mac_addr, QDF_MAC_ADDR_SIZE);
 		mac_addr = &local_mac_addr_aligned;
 	}
-	index = dp_peer_find_hash_index(soc, mac_addr);
-	qdf_spin_lock_bh(&soc->peer_hash_lock);
-	TAILQ_FOREACH(peer, &soc->peer_hash.bins[index], hash_list_elem) {
-		if (dp_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr) == 0 &&
-		    ((peer->vdev->vdev_id == vdev_id) ||
-		     (vdev_id == DP_VDEV_ALL))) {
-			/* take peer reference before returning */
-			if (dp_peer_get_ref(soc, peer, mod_id) !=
-						QDF_STATUS_SUCCESS)
-				peer = NULL;
-
-			qdf_spin_unlock_bh(&soc->peer_hash_lock);
-			return peer;
-		}
-	}
-	qdf_spin_unlock_bh(&soc->peer_hash_lock);
-	return NULL; /* failure */
+	return dp_peer_hash_bin_find(soc, mac_addr, vdev_id, mod_id);
 }
 
 qdf_export_symbol(dp_peer_find_hash_find);
@@ -577,22 +641,12 @@ qdf_export_symbol(dp_peer_find_hash_find);
 void dp_peer_find_hash_remove(struct dp_soc *soc, struct dp_peer *peer)
 {
 	unsigned index;
-	struct dp_peer *tmppeer = NULL;
-	int found = 0;
+	bool found;
 
 	index = dp_peer_find_hash_index(soc, &peer->mac_addr);
-	/* Check if tail is not empty before delete*/
-	QDF_ASSERT(!TAILQ_EMPTY(&soc->peer_hash.bins[index]));
-
 	qdf_spin_lock_bh(&soc->peer_hash_lock);
-	TAILQ_FOREACH(tmppeer, &soc->peer_hash.bins[index], hash_list_elem) {
-		if (tmppeer == peer) {
-			found = 1;
-			break;
-		}
-	}
+	found = dp_peer_hash_bin_remove(soc, index, peer);
 	QDF_ASSERT(found);
-	TAILQ_REMOVE(&soc->peer_hash.bins[index], peer, hash_list_elem);
 
 	dp_peer_unref_delete(peer, DP_MOD_ID_CONFIG);
 	qdf_spin_unlock_bh(&soc->peer_hash_lock);
@@ -618,7 +672,7 @@ static bool dp_peer_exist_on_pdev(struct dp_soc *soc,
 	}
 	index = dp_peer_find_hash_index(soc, mac_addr);
 	qdf_spin_lock_bh(&soc->peer_hash_lock);
-	TAILQ_FOREACH(peer, &soc->peer_hash.bins[index], hash_list_elem) {
+	dp_peer_hash_bin_for_each_locked(peer, soc, index) {
 		if (dp_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr) == 0 &&
 		    (peer->vdev->pdev == pdev)) {
 			found = true;
@@ -2233,15 +2287,18 @@ void dp_peer_find_hash_erase(struct dp_soc *soc)
 	 * it's known that the soc is no longer in use.
 	 */
 	for (i = 0; i <= soc->peer_hash.mask; i++) {
-		if (!TAILQ_EMPTY(&soc->peer_hash.bins[i])) {
+		if (soc->peer_hash.bins[i]) {
 			struct dp_peer *peer, *peer_next;
+			int mod_id;
 
 			/*
-			 * TAILQ_FOREACH_SAFE must be used here to avoid any
-			 * memory access violation after peer is freed
+			 * The next peer must be read before the current one
+			 * is released, to avoid any memory access violation
+			 * after peer is freed
 			 */
-			TAILQ_FOREACH_SAFE(peer, &soc->peer_hash.bins[i],
-				hash_list_elem, peer_next) {
+			for (peer = soc->peer_hash.bins[i]; peer;
+			     peer = peer_next) {
+				peer_next = peer->hash_next;
 				/*
 				 * Don't remove the peer from the hash table -
 				 * that would modify the list we are currently
@@ -2254,8 +2311,9 @@ void dp_peer_find_hash_erase(struct dp_soc *soc)
 				 */
 				/* set to zero */
 				qdf_atomic_init(&peer->ref_cnt);
-				for (i = 0; i < DP_MOD_ID_MAX; i++)
-					qdf_atomic_init(&peer->mod_refs[i]);
+				for (mod_id = 0; mod_id < DP_MOD_ID_MAX;
+				     mod_id++)
+					qdf_atomic_init(&peer->mod_refs[mod_id]);
 				/* incr to one */
 				qdf_atomic_inc(&peer->ref_cnt);
 				qdf_atomic_inc(&peer->mod_refs
@@ -4665,6 +4723,8 @@ QDF_STATUS dp_peer_ext_stats_ctx_alloc(struct dp_soc *soc,
 				       struct dp_peer *peer)
 {
 	uint8_t tid, ctx_id;
+	uint32_t size = sizeof(struct cdp_peer_ext_stats);
+	qdf_dma_addr_t paddr_unaligned, paddr_aligned;
 
 	if (!soc || !peer) {
 		dp_warn("Null soc%pK or peer%pK", soc, peer);
@@ -4675,9 +4735,16 @@ QDF_STATUS dp_peer_ext_stats_ctx_alloc(struct dp_soc *soc,
 		return QDF_STATUS_SUCCESS;
 
 	/*
-	 * Allocate memory for peer extended stats.
+	 * Allocate memory for peer extended stats. The Tx/Rx delay halves
+	 * are cacheline aligned within the struct, which only holds if the
+	 * struct itself is; qdf_mem_malloc() does not guarantee that when
+	 * MEMORY_DEBUG prepends its header.
 	 */
-	peer->pext_stats = qdf_mem_malloc(sizeof(struct cdp_peer_ext_stats));
+	peer->pext_stats = qdf_aligned_malloc(&size,
+					      &peer->pext_stats_unaligned,
+					      &paddr_unaligned,
+					      &paddr_aligned,
+					      QDF_CACHE_LINE_SZ);
 	if (!peer->pext_stats) {
 		dp_err("Peer extended stats obj alloc failed!!");
 		return QDF_STATUS_E_NOMEM;
@@ -4723,7 +4790,8 @@ void dp_peer_ext_stats_ctx_dealloc(struct dp_soc *soc, struct dp_peer *peer)
 	if (!peer->pext_stats)
 		return;
 
-	qdf_mem_free(peer->pext_stats);
+	qdf_mem_free(peer->pext_stats_unaligned);
+	peer->pext_stats_unaligned = NULL;
 	peer->pext_stats = NULL;
 }
 #endif
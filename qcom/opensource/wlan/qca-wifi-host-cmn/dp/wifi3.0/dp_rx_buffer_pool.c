@@ -115,18 +115,60 @@ void dp_rx_buffer_pool_nbuf_free(struct dp_soc *soc, qdf_nbuf_t nbuf, u8 mac_id)
 	qdf_nbuf_queue_head_enqueue_tail(&buff_pool->emerg_nbuf_q, nbuf);
 }
 
+/**
+ * dp_rx_refill_buff_pool_update_wm() - adapt the refill watermark to the
+ * consumption seen since the last refill
+ * @buff_pool: RX refill buffer pool
+ *
+ * An underrun pushes the watermark to the full ring, otherwise it follows
+ * twice the average consumption and decays by one burst per refill.
+ *
+ * Return: None
+ */
+static void
+dp_rx_refill_buff_pool_update_wm(struct rx_refill_buff_pool *buff_pool)
+{
+	uint32_t num_consumed = buff_pool->num_consumed;
+	uint32_t num_underrun = buff_pool->num_underrun;
+	uint16_t max_wm = buff_pool->max_bufq_len - 1;
+	uint32_t consumed, wm;
+
+	consumed = qdf_min(num_consumed - buff_pool->last_consumed,
+			   (uint32_t)max_wm);
+	buff_pool->last_consumed = num_consumed;
+	buff_pool->consume_rate = (buff_pool->consume_rate * 3 + consumed) / 4;
+
+	if (num_underrun != buff_pool->last_underrun) {
+		buff_pool->last_underrun = num_underrun;
+		buff_pool->watermark = max_wm;
+		return;
+	}
+
+	wm = qdf_max((uint32_t)buff_pool->consume_rate * 2,
+		     (uint32_t)DP_RX_REFILL_BUFF_POOL_MIN_WM);
+	if (buff_pool->watermark > DP_RX_REFILL_BUFF_POOL_BURST)
+		wm = qdf_max(wm, (uint32_t)(buff_pool->watermark -
+					    DP_RX_REFILL_BUFF_POOL_BURST));
+
+	buff_pool->watermark = qdf_min(wm, (uint32_t)max_wm);
+}
+
 void dp_rx_refill_buff_pool_enqueue(struct dp_soc *soc)
 {
 	struct rx_desc_pool *rx_desc_pool;
 	struct rx_refill_buff_pool *buff_pool;
+	qdf_nbuf_t nbuf_list[DP_RX_REFILL_BUFF_POOL_BURST];
+	struct dp_pdev *dp_pdev;
 	qdf_device_t dev;
-	qdf_nbuf_t nbuf;
 	QDF_STATUS ret;
-	int count, i;
+	uint16_t num_alloc, num_mapped, i;
 	uint16_t num_refill;
 	uint16_t total_num_refill;
 	uint16_t total_count = 0;
-	uint16_t head, tail;
+	uint16_t head;
+	uint64_t start_us;
+	uint32_t refill_us;
+	bool alloc_fail = false;
 
 	if (!soc)
 		return;
@@ -134,53 +176,89 @@ void dp_rx_refill_buff_pool_enqueue(struct dp_soc *soc)
 	dev = soc->osdev;
 	buff_pool = &soc->rx_refill_buff_pool;
 	rx_desc_pool = &soc->rx_desc_buf[0];
+	dp_pdev = buff_pool->dp_pdev;
 	if (!buff_pool->is_initialized)
 		return;
 
-	head = buff_pool->head;
-	tail = buff_pool->tail;
-	if (tail > head)
-		total_num_refill = (tail - head - 1);
-	else
-		total_num_refill = (DP_RX_REFILL_BUFF_POOL_SIZE - head +
-				    tail - 1);
+	if (dp_rx_refill_buff_pool_in_backoff(buff_pool))
+		return;
 
+	start_us = qdf_get_log_timestamp_usecs();
+
+	dp_rx_refill_buff_pool_update_wm(buff_pool);
+	total_num_refill = dp_rx_refill_buff_pool_deficit(buff_pool);
+
+	head = buff_pool->head;
 	while (total_num_refill) {
 		if (total_num_refill > DP_RX_REFILL_BUFF_POOL_BURST)
 			num_refill = DP_RX_REFILL_BUFF_POOL_BURST;
 		else
 			num_refill = total_num_refill;
 
-		count = 0;
-		for (i = 0; i < num_refill; i++) {
-			nbuf = qdf_nbuf_alloc(dev, rx_desc_pool->buf_size,
-					      RX_BUFFER_RESERVATION,
-					      rx_desc_pool->buf_alignment,
-					      FALSE);
-			if (qdf_unlikely(!nbuf))
-				continue;
+		/* Allocate the whole burst first, then map it in one pass */
+		for (num_alloc = 0; num_alloc < num_refill; num_alloc++) {
+			nbuf_list[num_alloc] =
+				qdf_nbuf_alloc(dev, rx_desc_pool->buf_size,
+					       RX_BUFFER_RESERVATION,
+					       rx_desc_pool->buf_alignment,
+					       FALSE);
+			if (qdf_unlikely(!nbuf_list[num_alloc]))
+				break;
+		}
 
-			ret = qdf_nbuf_map_nbytes_single(dev, nbuf,
+		num_mapped = 0;
+		for (i = 0; i < num_alloc; i++) {
+			ret = qdf_nbuf_map_nbytes_single(dev, nbuf_list[i],
 							 QDF_DMA_FROM_DEVICE,
 							 rx_desc_pool->buf_size);
 			if (qdf_unlikely(QDF_IS_STATUS_ERROR(ret))) {
-				qdf_nbuf_free(nbuf);
+				qdf_nbuf_free(nbuf_list[i]);
 				continue;
 			}
 
-			buff_pool->buf_elem[head++] = nbuf;
+			buff_pool->buf_elem[head++] = nbuf_list[i];
 			head &= (DP_RX_REFILL_BUFF_POOL_SIZE - 1);
-			count++;
+			num_mapped++;
 		}
 
-		if (count) {
-			buff_pool->head = head;
-			total_num_refill -= count;
-			total_count += count;
+		/* Publish the burst to the consumer at once */
+		buff_pool->head = head;
+		total_num_refill -= num_mapped;
+		total_count += num_mapped;
+
+		/*
+		 * Do not retry right away under memory pressure, the thread
+		 * is scheduled again by RX replenish once the backoff ends.
+		 */
+		if (qdf_unlikely(num_mapped < num_refill)) {
+			alloc_fail = true;
+			break;
 		}
 	}
 
-	DP_STATS_INC(buff_pool->dp_pdev,
+	if (qdf_unlikely(alloc_fail)) {
+		if (!buff_pool->backoff_ms)
+			buff_pool->backoff_ms = DP_RX_REFILL_BACKOFF_MIN_MS;
+		else
+			buff_pool->backoff_ms =
+				qdf_min(buff_pool->backoff_ms * 2,
+					(uint32_t)DP_RX_REFILL_BACKOFF_MAX_MS);
+		buff_pool->backoff_until = qdf_system_ticks() +
+			qdf_system_msecs_to_ticks(buff_pool->backoff_ms);
+		DP_STATS_INC(dp_pdev, rx_refill_buff_pool.num_alloc_fail, 1);
+	} else {
+		buff_pool->backoff_ms = 0;
+	}
+
+	refill_us = qdf_get_log_timestamp_usecs() - start_us;
+	DP_STATS_UPD(dp_pdev, rx_refill_buff_pool.refill_time_last_us,
+		     refill_us);
+	if (dp_pdev &&
+	    refill_us > dp_pdev->stats.rx_refill_buff_pool.refill_time_max_us)
+		DP_STATS_UPD(dp_pdev, rx_refill_buff_pool.refill_time_max_us,
+			     refill_us);
+
+	DP_STATS_INC(dp_pdev,
 		     rx_refill_buff_pool.num_bufs_refilled,
 		     total_count);
 }
@@ -211,16 +289,23 @@ dp_rx_buffer_pool_nbuf_alloc(struct dp_soc *soc, uint32_t mac_id,
 {
 	struct dp_pdev *dp_pdev = dp_get_pdev_for_lmac_id(soc, mac_id);
 	struct rx_buff_pool *buff_pool;
+	struct rx_refill_buff_pool *refill_pool = &soc->rx_refill_buff_pool;
 	struct dp_srng *dp_rxdma_srng;
 	qdf_nbuf_t nbuf;
 
 	nbuf = dp_rx_refill_buff_pool_dequeue_nbuf(soc);
 	if (qdf_likely(nbuf)) {
+		refill_pool->num_consumed++;
 		DP_STATS_INC(dp_pdev,
 			     rx_refill_buff_pool.num_bufs_allocated, 1);
 		return nbuf;
 	}
 
+	if (refill_pool->is_initialized) {
+		refill_pool->num_underrun++;
+		DP_STATS_INC(dp_pdev, rx_refill_buff_pool.num_underrun, 1);
+	}
+
 	if (!wlan_cfg_per_pdev_lmac_ring(soc->wlan_cfg_ctx))
 		mac_id = dp_pdev->lmac_id;
 
@@ -288,6 +373,13 @@ static void dp_rx_refill_buff_pool_init(struct dp_soc *soc, u8 mac_id)
 	buff_pool->max_bufq_len = DP_RX_REFILL_BUFF_POOL_SIZE;
 	buff_pool->dp_pdev = dp_get_pdev_for_lmac_id(soc, 0);
 	buff_pool->tail = 0;
+	buff_pool->watermark = buff_pool->max_bufq_len - 1;
+	buff_pool->consume_rate = 0;
+	buff_pool->num_consumed = 0;
+	buff_pool->last_consumed = 0;
+	buff_pool->num_underrun = 0;
+	buff_pool->last_underrun = 0;
+	buff_pool->backoff_ms = 0;
 
 	for (i = 0; i < (buff_pool->max_bufq_len - 1); i++) {
 		nbuf = qdf_nbuf_alloc(soc->osdev, rx_desc_pool->buf_size,
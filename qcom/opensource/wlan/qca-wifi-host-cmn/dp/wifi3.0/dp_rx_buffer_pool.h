@@ -96,6 +96,40 @@ dp_rx_buffer_pool_nbuf_map(struct dp_soc *soc,
 			   struct rx_desc_pool *rx_desc_pool,
 			   struct dp_rx_nbuf_frag_info *nbuf_frag_info_t);
 
+/**
+ * dp_rx_refill_buff_pool_deficit() - number of buffers missing to reach
+ * the refill pool watermark
+ * @buff_pool: RX refill buffer pool
+ *
+ * Return: buffers to be refilled
+ */
+static inline uint16_t
+dp_rx_refill_buff_pool_deficit(struct rx_refill_buff_pool *buff_pool)
+{
+	uint16_t filled = (buff_pool->head - buff_pool->tail) &
+			  (DP_RX_REFILL_BUFF_POOL_SIZE - 1);
+
+	if (filled >= buff_pool->watermark)
+		return 0;
+
+	return buff_pool->watermark - filled;
+}
+
+/**
+ * dp_rx_refill_buff_pool_in_backoff() - refill is backing off after an
+ * allocation failure
+ * @buff_pool: RX refill buffer pool
+ *
+ * Return: true if the refill should be skipped for now
+ */
+static inline bool
+dp_rx_refill_buff_pool_in_backoff(struct rx_refill_buff_pool *buff_pool)
+{
+	return buff_pool->backoff_ms &&
+	       qdf_system_time_before(qdf_system_ticks(),
+				      buff_pool->backoff_until);
+}
+
 /**
  * dp_rx_schedule_refill_thread() - Schedule RX refill thread to enqueue
  * buffers in refill pool
@@ -105,20 +139,17 @@ dp_rx_buffer_pool_nbuf_map(struct dp_soc *soc,
 static inline void dp_rx_schedule_refill_thread(struct dp_soc *soc)
 {
 	struct rx_refill_buff_pool *buff_pool = &soc->rx_refill_buff_pool;
-	uint16_t head = buff_pool->head;
-	uint16_t tail = buff_pool->tail;
-	uint16_t num_refill;
+	uint16_t threshold;
 
-	if (!buff_pool->is_initialized)
+	if (!buff_pool->is_initialized ||
+	    dp_rx_refill_buff_pool_in_backoff(buff_pool))
 		return;
 
-	if (tail > head)
-		num_refill = (tail - head - 1);
-	else
-		num_refill = (DP_RX_REFILL_BUFF_POOL_SIZE - head + tail - 1);
+	threshold = qdf_min((uint16_t)DP_RX_REFILL_THRD_THRESHOLD,
+			    (uint16_t)(buff_pool->watermark / 4));
 
 	if (soc->cdp_soc.ol_ops->dp_rx_sched_refill_thread &&
-	    num_refill >= DP_RX_REFILL_THRD_THRESHOLD)
+	    dp_rx_refill_buff_pool_deficit(buff_pool) >= threshold)
 		soc->cdp_soc.ol_ops->dp_rx_sched_refill_thread(
 						dp_soc_to_cdp_soc_t(soc));
 }
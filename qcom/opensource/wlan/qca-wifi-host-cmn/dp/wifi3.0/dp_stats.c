@@ -6650,6 +6650,19 @@ dp_print_pdev_rx_stats(struct dp_pdev *pdev)
 		       pdev->stats.rx_buffer_pool.num_bufs_alloc_success);
 	DP_PRINT_STATS("\tAllocations from the pool during replenish = %llu",
 		       pdev->stats.rx_buffer_pool.num_pool_bufs_replenish);
+
+	DP_PRINT_STATS("RX Refill Buffer Pool Stats:\n");
+	DP_PRINT_STATS("\tBuffers refilled = %llu",
+		       pdev->stats.rx_refill_buff_pool.num_bufs_refilled);
+	DP_PRINT_STATS("\tBuffers allocated from the pool = %llu",
+		       pdev->stats.rx_refill_buff_pool.num_bufs_allocated);
+	DP_PRINT_STATS("\tPool underruns = %llu",
+		       pdev->stats.rx_refill_buff_pool.num_underrun);
+	DP_PRINT_STATS("\tRefill allocation failures = %llu",
+		       pdev->stats.rx_refill_buff_pool.num_alloc_fail);
+	DP_PRINT_STATS("\tRefill time last/max = %u/%u us",
+		       pdev->stats.rx_refill_buff_pool.refill_time_last_us,
+		       pdev->stats.rx_refill_buff_pool.refill_time_max_us);
 }
 
 void
@@ -155,6 +155,11 @@
 #define DP_RX_REFILL_BUFF_POOL_SIZE  2048
 #define DP_RX_REFILL_BUFF_POOL_BURST 64
 #define DP_RX_REFILL_THRD_THRESHOLD  512
+/* lowest fill level the refill pool adapts down to */
+#define DP_RX_REFILL_BUFF_POOL_MIN_WM 256
+/* refill backoff after an allocation failure, doubled up to the max */
+#define DP_RX_REFILL_BACKOFF_MIN_MS  1
+#define DP_RX_REFILL_BACKOFF_MAX_MS  64
 #endif
 
 #ifdef WLAN_VENDOR_SPECIFIC_BAR_UPDATE
@@ -1299,12 +1304,39 @@ struct rx_buff_pool {
 	bool is_initialized;
 };
 
+/**
+ * struct rx_refill_buff_pool - pre-mapped RX buffers filled by the refill
+ * thread (producer, owns @head) and used by RX replenish (consumer, owns
+ * @tail)
+ * @is_initialized: pool is usable
+ * @head: producer index
+ * @tail: consumer index
+ * @dp_pdev: pdev the stats are accounted to
+ * @max_bufq_len: ring size
+ * @watermark: fill level the refill thread tops the pool up to
+ * @consume_rate: moving average of buffers consumed between refills
+ * @num_consumed: buffers handed out, written by the consumer only
+ * @last_consumed: @num_consumed seen by the last refill
+ * @num_underrun: requests that found the pool empty, consumer only
+ * @last_underrun: @num_underrun seen by the last refill
+ * @backoff_ms: current refill backoff, 0 if not backing off
+ * @backoff_until: system ticks until which refill is skipped
+ * @buf_elem: ring of mapped buffers
+ */
 struct rx_refill_buff_pool {
 	bool is_initialized;
 	uint16_t head;
 	uint16_t tail;
 	struct dp_pdev *dp_pdev;
 	uint16_t max_bufq_len;
+	uint16_t watermark;
+	uint16_t consume_rate;
+	uint32_t num_consumed;
+	uint32_t last_consumed;
+	uint32_t num_underrun;
+	uint32_t last_underrun;
+	uint32_t backoff_ms;
+	qdf_time_t backoff_until;
 	qdf_nbuf_t buf_elem[2048];
 };
 
@@ -2002,7 +2034,8 @@ struct dp_soc {
 	struct {
 		unsigned mask;
 		unsigned idx_bits;
-		TAILQ_HEAD(, dp_peer) * bins;
+		/* chains of link peers, RCU protected against peer_hash_lock */
+		struct dp_peer **bins;
 	} peer_hash;
 
 	/* rx defrag state – TBD: do we need this per radio? */
@@ -3377,8 +3410,12 @@ struct dp_peer {
 
 	/* node in the vdev's list of peers */
 	TAILQ_ENTRY(dp_peer) peer_list_elem;
-	/* node in the hash table bin's list of peers */
+	/* node in the MLD peer hash table bin's list of peers */
 	TAILQ_ENTRY(dp_peer) hash_list_elem;
+	/* next link peer in the peer_hash bin, RCU protected */
+	struct dp_peer *hash_next;
+	/* defers the free of the peer past concurrent hash readers */
+	qdf_rcu_head_t rcu;
 
 	/* TID structures pointer */
 	struct dp_rx_tid *rx_tid;
@@ -3424,6 +3461,8 @@ struct dp_peer {
 
 	/* Peer extended stats */
 	struct cdp_peer_ext_stats *pext_stats;
+	/* Allocation backing pext_stats, which is cacheline aligned */
+	void *pext_stats_unaligned;
 
 	TAILQ_HEAD(, dp_ast_entry) ast_entry_list;
 	/* TBD */
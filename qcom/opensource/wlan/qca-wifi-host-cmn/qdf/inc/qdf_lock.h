@@ -244,6 +244,12 @@ typedef struct qdf_spinlock qdf_spinlock_t;
 typedef __qdf_semaphore_t qdf_semaphore_t;
 typedef __qdf_mutex_t qdf_mutex_t;
 
+/**
+ * typedef qdf_rcu_head_t - callback head for deferring a free past an RCU
+ * grace period, see qdf_call_rcu()
+ */
+typedef __qdf_rcu_head_t qdf_rcu_head_t;
+
 /* function Declaration */
 QDF_STATUS qdf_mutex_create(qdf_mutex_t *m, const char *func, int line);
 #define qdf_mutex_create(m) qdf_mutex_create(m, __func__, __LINE__)
@@ -588,4 +594,60 @@ void qdf_runtime_lock_deinit(qdf_runtime_lock_t *lock);
 QDF_STATUS qdf_spinlock_acquire(qdf_spinlock_t *lock);
 
 QDF_STATUS qdf_spinlock_release(qdf_spinlock_t *lock);
+
+/**
+ * qdf_rcu_read_lock() - mark the beginning of an RCU read-side section
+ *
+ * Return: none
+ */
+#define qdf_rcu_read_lock() __qdf_rcu_read_lock()
+
+/**
+ * qdf_rcu_read_unlock() - mark the end of an RCU read-side section
+ *
+ * Return: none
+ */
+#define qdf_rcu_read_unlock() __qdf_rcu_read_unlock()
+
+/**
+ * qdf_rcu_dereference() - fetch an RCU protected pointer for reading
+ * @_p: pointer to fetch, only valid inside qdf_rcu_read_lock()
+ *
+ * Return: value of @_p
+ */
+#define qdf_rcu_dereference(_p) __qdf_rcu_dereference(_p)
+
+/**
+ * qdf_rcu_dereference_protected() - fetch an RCU protected pointer on the
+ * update side, with the writer lock held
+ * @_p: pointer to fetch
+ *
+ * Return: value of @_p
+ */
+#define qdf_rcu_dereference_protected(_p) __qdf_rcu_dereference_protected(_p)
+
+/**
+ * qdf_rcu_assign_pointer() - publish a pointer to RCU readers
+ * @_p: pointer to assign
+ * @_v: value to publish, initialized before the call
+ *
+ * Return: none
+ */
+#define qdf_rcu_assign_pointer(_p, _v) __qdf_rcu_assign_pointer(_p, _v)
+
+/**
+ * qdf_call_rcu() - run @_func once all current RCU readers are done
+ * @_head: callback head embedded in the object
+ * @_func: callback, runs in softirq context
+ *
+ * Return: none
+ */
+#define qdf_call_rcu(_head, _func) __qdf_call_rcu(_head, _func)
+
+/**
+ * qdf_rcu_barrier() - wait for all pending qdf_call_rcu() callbacks
+ *
+ * Return: none
+ */
+#define qdf_rcu_barrier() __qdf_rcu_barrier()
 #endif /* _QDF_LOCK_H */
@@ -89,6 +89,11 @@ typedef struct qdf_sglist {
  */
 #define qdf_packed __qdf_packed
 
+/**
+ * qdf_cacheline_aligned - align a structure or member to a cacheline on SMP
+ */
+#define qdf_cacheline_aligned __qdf_cacheline_aligned
+
 /**
  * qdf_toupper - char lower to upper.
  */
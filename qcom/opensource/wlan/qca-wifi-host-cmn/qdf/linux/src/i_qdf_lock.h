@@ -37,6 +37,7 @@
 #include <linux/semaphore.h>
 #endif
 #include <linux/interrupt.h>
+#include <linux/rcupdate.h>
 #include <linux/pm_wakeup.h>
 
 /* define for flag */
@@ -84,6 +85,8 @@ typedef struct __qdf_spinlock {
 
 typedef struct semaphore __qdf_semaphore_t;
 
+typedef struct rcu_head __qdf_rcu_head_t;
+
 /**
  * typedef struct - qdf_wake_lock_t
  * @lock: this lock needs to be used in kernel version < 5.4
@@ -349,6 +352,14 @@ static inline bool __qdf_in_softirq(void)
 	return in_softirq();
 }
 
+#define __qdf_rcu_read_lock() rcu_read_lock()
+#define __qdf_rcu_read_unlock() rcu_read_unlock()
+#define __qdf_rcu_dereference(_p) rcu_dereference(_p)
+#define __qdf_rcu_dereference_protected(_p) rcu_dereference_protected(_p, 1)
+#define __qdf_rcu_assign_pointer(_p, _v) rcu_assign_pointer(_p, _v)
+#define __qdf_call_rcu(_head, _func) call_rcu(_head, _func)
+#define __qdf_rcu_barrier() rcu_barrier()
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -67,6 +67,7 @@
 #endif
 
 #define __qdf_must_check __must_check
+#define __qdf_cacheline_aligned ____cacheline_aligned_in_smp
 
 typedef struct sg_table __sgtable_t;
 
@@ -135,6 +136,7 @@ typedef unsigned long __sgtable_t;
 #define __QDF_HRTIMER_NORESTART 0
 #define __QDF_HRTIMER_RESTART 0
 #define __iomem
+#define __qdf_cacheline_aligned
 #endif /* __KERNEL__ */
 
 /*
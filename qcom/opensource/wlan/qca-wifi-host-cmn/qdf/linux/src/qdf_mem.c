@@ -32,6 +32,8 @@
 #include "qdf_str.h"
 #include "qdf_talloc.h"
 #include <linux/debugfs.h>
+#include <linux/hash.h>
+#include <linux/percpu.h>
 #include <linux/seq_file.h>
 #include <linux/string.h>
 #include <qdf_list.h>
@@ -52,6 +54,14 @@ qdf_export_symbol(mem_debug_disabled);
 
 #ifdef MEMORY_DEBUG
 static bool is_initial_mem_debug_disabled;
+
+/*
+ * Track one in every mem_debug_sample_rate allocations; 0 and 1 track all of
+ * them. Untracked allocations still carry a header and trailer, so corruption
+ * and double frees are caught, but they are not reported as leaks.
+ */
+static uint32_t mem_debug_sample_rate;
+qdf_declare_param(mem_debug_sample_rate, uint);
 #endif
 
 /* Preprocessor Definitions and Constants */
@@ -118,20 +128,51 @@ struct major_alloc_priv {
 	uint32_t threshold;
 };
 
-static qdf_list_t qdf_mem_domains[QDF_DEBUG_DOMAIN_COUNT];
-static qdf_spinlock_t qdf_mem_list_lock;
+#define QDF_MEM_DEBUG_SHARD_BITS 4
+#define QDF_MEM_DEBUG_SHARD_COUNT (1 << QDF_MEM_DEBUG_SHARD_BITS)
+
+/**
+ * struct qdf_mem_debug_shard - one slice of the kmalloc tracking lists
+ * @lock: protects @domains
+ * @domains: per debug domain lists of the allocations hashed to this shard
+ *
+ * Allocations are spread over the shards by their header address, so
+ * concurrent alloc/free on different CPUs rarely contend on the same lock.
+ */
+struct qdf_mem_debug_shard {
+	qdf_spinlock_t lock;
+	qdf_list_t domains[QDF_DEBUG_DOMAIN_COUNT];
+} ____cacheline_aligned_in_smp;
+
+static struct qdf_mem_debug_shard qdf_mem_shards[QDF_MEM_DEBUG_SHARD_COUNT];
+static DEFINE_PER_CPU(uint32_t, qdf_mem_sample_cnt);
 
 static qdf_list_t qdf_mem_dma_domains[QDF_DEBUG_DOMAIN_COUNT];
 static qdf_spinlock_t qdf_mem_dma_list_lock;
 
-static inline qdf_list_t *qdf_mem_list_get(enum qdf_debug_domain domain)
+static inline qdf_list_t *qdf_mem_dma_list(enum qdf_debug_domain domain)
 {
-	return &qdf_mem_domains[domain];
+	return &qdf_mem_dma_domains[domain];
 }
 
-static inline qdf_list_t *qdf_mem_dma_list(enum qdf_debug_domain domain)
+static inline struct qdf_mem_debug_shard *qdf_mem_shard_get(void *header)
 {
-	return &qdf_mem_dma_domains[domain];
+	return &qdf_mem_shards[hash_ptr(header, QDF_MEM_DEBUG_SHARD_BITS)];
+}
+
+/**
+ * qdf_mem_debug_sampled() - check if the next allocation should be tracked
+ *
+ * Return: true if the allocation should be added to the tracking lists
+ */
+static inline bool qdf_mem_debug_sampled(void)
+{
+	uint32_t rate = READ_ONCE(mem_debug_sample_rate);
+
+	if (rate <= 1)
+		return true;
+
+	return !(this_cpu_inc_return(qdf_mem_sample_cnt) % rate);
 }
 
 /**
@@ -140,6 +181,8 @@ static inline qdf_list_t *qdf_mem_dma_list(enum qdf_debug_domain domain)
  * @domain: the active memory domain at time of allocation
  * @freed: flag set during free, used to detect double frees
  *	Use uint8_t so we can detect corruption
+ * @tracked: set if @node is linked into a tracking list; cleared for
+ *	allocations skipped by sampling. Use uint8_t so we can detect corruption
  * @func: name of the function the allocation was made from
  * @line: line number of the file the allocation was made from
  * @size: size of the allocation in bytes
@@ -151,6 +194,7 @@ struct qdf_mem_header {
 	qdf_list_node_t node;
 	enum qdf_debug_domain domain;
 	uint8_t freed;
+	uint8_t tracked;
 	char func[QDF_MEM_FUNC_NAME_SIZE];
 	uint32_t line;
 	uint32_t size;
@@ -214,6 +258,7 @@ static void qdf_mem_header_init(struct qdf_mem_header *header, qdf_size_t size,
 
 	header->domain = qdf_debug_domain_get();
 	header->freed = false;
+	header->tracked = true;
 
 	qdf_str_lcopy(header->func, func, QDF_MEM_FUNC_NAME_SIZE);
 
@@ -262,8 +307,12 @@ qdf_mem_header_validate(struct qdf_mem_header *header,
 	else if (header->freed)
 		error_bitmap |= QDF_MEM_BAD_FREED;
 
-	if (!qdf_list_node_in_any_list(&header->node))
+	if (header->tracked == true) {
+		if (!qdf_list_node_in_any_list(&header->node))
+			error_bitmap |= QDF_MEM_BAD_NODE;
+	} else if (header->tracked) {
 		error_bitmap |= QDF_MEM_BAD_NODE;
+	}
 
 	if (header->domain < QDF_DEBUG_DOMAIN_INIT ||
 	    header->domain >= QDF_DEBUG_DOMAIN_COUNT)
@@ -400,50 +449,108 @@ static bool qdf_mem_meta_table_insert(struct __qdf_mem_info *table,
 	return i >= QDF_MEM_STAT_TABLE_SIZE - 1;
 }
 
+typedef void (*qdf_mem_table_print_t)(struct __qdf_mem_info *,
+				      qdf_abstract_print, void *, uint32_t);
+
 /**
- * qdf_mem_domain_print() - output agnostic memory domain print logic
- * @domain: the memory domain to print
+ * qdf_mem_list_print() - collect one tracking list into a metadata table
+ * @list: the tracking list to walk
+ * @lock: the lock protecting @list
+ * @table: the metadata table to accumulate into; flushed whenever it fills
  * @print: the print adapter function
  * @print_priv: the private data to be consumed by @print
- * @threshold: the threshold value set by uset to list top allocations
+ * @threshold: the threshold value set by user to list top allocations
  * @mem_print: pointer to function which prints the memory allocation data
  *
  * Return: None
  */
-static void qdf_mem_domain_print(qdf_list_t *domain,
-				 qdf_abstract_print print,
-				 void *print_priv,
-				 uint32_t threshold,
-				 void (*mem_print)(struct __qdf_mem_info *,
-						   qdf_abstract_print,
-						   void *, uint32_t))
+static void qdf_mem_list_print(qdf_list_t *list,
+			       qdf_spinlock_t *lock,
+			       struct __qdf_mem_info *table,
+			       qdf_abstract_print print,
+			       void *print_priv,
+			       uint32_t threshold,
+			       qdf_mem_table_print_t mem_print)
 {
 	QDF_STATUS status;
-	struct __qdf_mem_info table[QDF_MEM_STAT_TABLE_SIZE];
 	qdf_list_node_t *node;
 
-	qdf_mem_zero(table, sizeof(table));
-	qdf_mem_debug_print_header(print, print_priv, threshold);
-
 	/* hold lock while inserting to avoid use-after free of the metadata */
-	qdf_spin_lock(&qdf_mem_list_lock);
-	status = qdf_list_peek_front(domain, &node);
+	qdf_spin_lock(lock);
+	status = qdf_list_peek_front(list, &node);
 	while (QDF_IS_STATUS_SUCCESS(status)) {
 		struct qdf_mem_header *meta = (struct qdf_mem_header *)node;
 		bool is_full = qdf_mem_meta_table_insert(table, meta);
 
-		qdf_spin_unlock(&qdf_mem_list_lock);
+		qdf_spin_unlock(lock);
 
 		if (is_full) {
 			(*mem_print)(table, print, print_priv, threshold);
-			qdf_mem_zero(table, sizeof(table));
+			qdf_mem_zero(table,
+				     sizeof(*table) * QDF_MEM_STAT_TABLE_SIZE);
 		}
 
-		qdf_spin_lock(&qdf_mem_list_lock);
-		status = qdf_list_peek_next(domain, node, &node);
+		qdf_spin_lock(lock);
+		status = qdf_list_peek_next(list, node, &node);
 	}
-	qdf_spin_unlock(&qdf_mem_list_lock);
+	qdf_spin_unlock(lock);
+}
 
+/**
+ * qdf_mem_domain_print() - output agnostic memory domain print logic
+ * @domain: the memory domain to print
+ * @lock: the lock protecting @domain
+ * @print: the print adapter function
+ * @print_priv: the private data to be consumed by @print
+ * @threshold: the threshold value set by uset to list top allocations
+ * @mem_print: pointer to function which prints the memory allocation data
+ *
+ * Return: None
+ */
+static void qdf_mem_domain_print(qdf_list_t *domain,
+				 qdf_spinlock_t *lock,
+				 qdf_abstract_print print,
+				 void *print_priv,
+				 uint32_t threshold,
+				 qdf_mem_table_print_t mem_print)
+{
+	struct __qdf_mem_info table[QDF_MEM_STAT_TABLE_SIZE];
+
+	qdf_mem_zero(table, sizeof(table));
+	qdf_mem_debug_print_header(print, print_priv, threshold);
+	qdf_mem_list_print(domain, lock, table, print, print_priv, threshold,
+			   mem_print);
+	(*mem_print)(table, print, print_priv, threshold);
+}
+
+/**
+ * qdf_mem_shards_print() - print a memory domain across all tracking shards
+ * @domain: the memory domain to print
+ * @print: the print adapter function
+ * @print_priv: the private data to be consumed by @print
+ * @threshold: the threshold value set by user to list top allocations
+ * @mem_print: pointer to function which prints the memory allocation data
+ *
+ * Return: None
+ */
+static void qdf_mem_shards_print(enum qdf_debug_domain domain,
+				 qdf_abstract_print print,
+				 void *print_priv,
+				 uint32_t threshold,
+				 qdf_mem_table_print_t mem_print)
+{
+	struct __qdf_mem_info table[QDF_MEM_STAT_TABLE_SIZE];
+	struct qdf_mem_debug_shard *shard;
+	int i;
+
+	qdf_mem_zero(table, sizeof(table));
+	qdf_mem_debug_print_header(print, print_priv, threshold);
+	for (i = 0; i < QDF_MEM_DEBUG_SHARD_COUNT; i++) {
+		shard = &qdf_mem_shards[i];
+		qdf_mem_list_print(&shard->domains[domain], &shard->lock,
+				   table, print, print_priv, threshold,
+				   mem_print);
+	}
 	(*mem_print)(table, print, print_priv, threshold);
 }
 
@@ -656,7 +763,7 @@ static int qdf_mem_seq_show(struct seq_file *seq, void *v)
 
 	seq_printf(seq, "\n%s Memory Domain (Id %d)\n",
 		   qdf_debug_domain_name(domain_id), domain_id);
-	qdf_mem_domain_print(qdf_mem_list_get(domain_id),
+	qdf_mem_shards_print(domain_id,
 			     seq_printf_printer,
 			     seq,
 			     0,
@@ -690,7 +797,6 @@ static int qdf_major_alloc_show(struct seq_file *seq, void *v)
 {
 	enum qdf_debug_domain domain_id = *(enum qdf_debug_domain *)v;
 	struct major_alloc_priv *priv;
-	qdf_list_t *list;
 
 	priv = (struct major_alloc_priv *)seq->private;
 	seq_printf(seq, "\n%s Memory Domain (Id %d)\n",
@@ -698,22 +804,23 @@ static int qdf_major_alloc_show(struct seq_file *seq, void *v)
 
 	switch (priv->type) {
 	case LIST_TYPE_MEM:
-		list = qdf_mem_list_get(domain_id);
+		qdf_mem_shards_print(domain_id,
+				     seq_printf_printer,
+				     seq,
+				     priv->threshold,
+				     qdf_print_major_alloc);
 		break;
 	case LIST_TYPE_DMA:
-		list = qdf_mem_dma_list(domain_id);
-		break;
-	default:
-		list = NULL;
-		break;
-	}
-
-	if (list)
-		qdf_mem_domain_print(list,
+		qdf_mem_domain_print(qdf_mem_dma_list(domain_id),
+				     &qdf_mem_dma_list_lock,
 				     seq_printf_printer,
 				     seq,
 				     priv->threshold,
 				     qdf_print_major_alloc);
+		break;
+	default:
+		break;
+	}
 
 	return 0;
 }
@@ -1486,17 +1593,19 @@ QDF_STATUS qdf_mem_debug_disabled_config_set(const char *str_value)
  */
 static void qdf_mem_debug_init(void)
 {
-	int i;
+	int i, j;
 
 	is_initial_mem_debug_disabled = qdf_mem_debug_config_get();
 
 	if (is_initial_mem_debug_disabled)
 		return;
 
-	/* Initalizing the list with maximum size of 60000 */
-	for (i = 0; i < QDF_DEBUG_DOMAIN_COUNT; ++i)
-		qdf_list_create(&qdf_mem_domains[i], 60000);
-	qdf_spinlock_create(&qdf_mem_list_lock);
+	/* Initalizing each shard list with maximum size of 60000 */
+	for (i = 0; i < QDF_MEM_DEBUG_SHARD_COUNT; ++i) {
+		for (j = 0; j < QDF_DEBUG_DOMAIN_COUNT; ++j)
+			qdf_list_create(&qdf_mem_shards[i].domains[j], 60000);
+		qdf_spinlock_create(&qdf_mem_shards[i].lock);
+	}
 
 	/* dma */
 	for (i = 0; i < QDF_DEBUG_DOMAIN_COUNT; ++i)
@@ -1517,6 +1626,7 @@ qdf_mem_domain_check_for_leaks(enum qdf_debug_domain domain,
 	qdf_err("Memory leaks detected in %s domain!",
 		qdf_debug_domain_name(domain));
 	qdf_mem_domain_print(mem_list,
+			     &qdf_mem_dma_list_lock,
 			     qdf_err_printer,
 			     NULL,
 			     0,
@@ -1525,6 +1635,34 @@ qdf_mem_domain_check_for_leaks(enum qdf_debug_domain domain,
 	return mem_list->count;
 }
 
+static uint32_t qdf_mem_shards_check_for_leaks(enum qdf_debug_domain domain)
+{
+	uint32_t rate = READ_ONCE(mem_debug_sample_rate);
+	uint32_t count = 0;
+	int i;
+
+	if (is_initial_mem_debug_disabled)
+		return 0;
+
+	for (i = 0; i < QDF_MEM_DEBUG_SHARD_COUNT; ++i)
+		count += qdf_list_size(&qdf_mem_shards[i].domains[domain]);
+
+	if (!count)
+		return 0;
+
+	qdf_err("Memory leaks detected in %s domain!",
+		qdf_debug_domain_name(domain));
+	if (rate > 1)
+		qdf_err("Only 1 in %u allocations is tracked", rate);
+	qdf_mem_shards_print(domain,
+			     qdf_err_printer,
+			     NULL,
+			     0,
+			     qdf_mem_meta_table_print);
+
+	return count;
+}
+
 static void qdf_mem_domain_set_check_for_leaks(qdf_list_t *domains)
 {
 	uint32_t leak_count = 0;
@@ -1549,17 +1687,25 @@ static void qdf_mem_domain_set_check_for_leaks(qdf_list_t *domains)
  */
 static void qdf_mem_debug_exit(void)
 {
-	int i;
+	uint32_t leak_count = 0;
+	int i, j;
 
 	if (is_initial_mem_debug_disabled)
 		return;
 
 	/* mem */
-	qdf_mem_domain_set_check_for_leaks(qdf_mem_domains);
 	for (i = 0; i < QDF_DEBUG_DOMAIN_COUNT; ++i)
-		qdf_list_destroy(qdf_mem_list_get(i));
+		leak_count += qdf_mem_shards_check_for_leaks(i);
+
+	if (leak_count)
+		QDF_MEMDEBUG_PANIC("%u fatal memory leaks detected!",
+				   leak_count);
 
-	qdf_spinlock_destroy(&qdf_mem_list_lock);
+	for (i = 0; i < QDF_MEM_DEBUG_SHARD_COUNT; ++i) {
+		for (j = 0; j < QDF_DEBUG_DOMAIN_COUNT; ++j)
+			qdf_list_destroy(&qdf_mem_shards[i].domains[j]);
+		qdf_spinlock_destroy(&qdf_mem_shards[i].lock);
+	}
 
 	/* dma */
 	qdf_mem_domain_set_check_for_leaks(qdf_mem_dma_domains);
@@ -1568,12 +1714,66 @@ static void qdf_mem_debug_exit(void)
 	qdf_spinlock_destroy(&qdf_mem_dma_list_lock);
 }
 
+/**
+ * qdf_mem_header_track() - add a kmalloc header to its tracking shard
+ * @header: the initialized memory header
+ *
+ * Return: None
+ */
+static void qdf_mem_header_track(struct qdf_mem_header *header)
+{
+	struct qdf_mem_debug_shard *shard = qdf_mem_shard_get(header);
+	QDF_STATUS status;
+
+	qdf_spin_lock_irqsave(&shard->lock);
+	status = qdf_list_insert_front(&shard->domains[header->domain],
+				       &header->node);
+	qdf_spin_unlock_irqrestore(&shard->lock);
+	if (QDF_IS_STATUS_ERROR(status)) {
+		qdf_err("Failed to insert memory header; status %d", status);
+		header->tracked = false;
+	}
+}
+
+/**
+ * qdf_mem_header_untrack() - validate a kmalloc header and drop its tracking
+ * @header: the memory header being freed
+ * @domain: the current debug domain
+ *
+ * Return: the validation errors found; the header is only marked freed and
+ *	unlinked when there are none
+ */
+static enum qdf_mem_validation_bitmap
+qdf_mem_header_untrack(struct qdf_mem_header *header,
+		       enum qdf_debug_domain domain)
+{
+	struct qdf_mem_debug_shard *shard = NULL;
+	enum qdf_mem_validation_bitmap error_bitmap;
+
+	if (header->tracked == true) {
+		shard = qdf_mem_shard_get(header);
+		qdf_spin_lock_irqsave(&shard->lock);
+	}
+
+	error_bitmap = qdf_mem_header_validate(header, domain);
+	error_bitmap |= qdf_mem_trailer_validate(header);
+
+	if (!error_bitmap) {
+		header->freed = true;
+		if (shard)
+			qdf_list_remove_node(&shard->domains[header->domain],
+					     &header->node);
+	}
+
+	if (shard)
+		qdf_spin_unlock_irqrestore(&shard->lock);
+
+	return error_bitmap;
+}
+
 void *qdf_mem_malloc_debug(size_t size, const char *func, uint32_t line,
 			   void *caller, uint32_t flag)
 {
-	QDF_STATUS status;
-	enum qdf_debug_domain current_domain = qdf_debug_domain_get();
-	qdf_list_t *mem_list = qdf_mem_list_get(current_domain);
 	struct qdf_mem_header *header;
 	void *ptr;
 	unsigned long start, duration;
@@ -1610,11 +1810,10 @@ void *qdf_mem_malloc_debug(size_t size, const char *func, uint32_t line,
 	qdf_mem_trailer_init(header);
 	ptr = qdf_mem_get_ptr(header);
 
-	qdf_spin_lock_irqsave(&qdf_mem_list_lock);
-	status = qdf_list_insert_front(mem_list, &header->node);
-	qdf_spin_unlock_irqrestore(&qdf_mem_list_lock);
-	if (QDF_IS_STATUS_ERROR(status))
-		qdf_err("Failed to insert memory header; status %d", status);
+	if (qdf_mem_debug_sampled())
+		qdf_mem_header_track(header);
+	else
+		header->tracked = false;
 
 	qdf_mem_kmalloc_inc(ksize(header));
 
@@ -1646,17 +1845,8 @@ void qdf_mem_free_debug(void *ptr, const char *func, uint32_t line)
 
 	qdf_talloc_assert_no_children_fl(ptr, func, line);
 
-	qdf_spin_lock_irqsave(&qdf_mem_list_lock);
 	header = qdf_mem_get_header(ptr);
-	error_bitmap = qdf_mem_header_validate(header, current_domain);
-	error_bitmap |= qdf_mem_trailer_validate(header);
-
-	if (!error_bitmap) {
-		header->freed = true;
-		qdf_list_remove_node(qdf_mem_list_get(header->domain),
-				     &header->node);
-	}
-	qdf_spin_unlock_irqrestore(&qdf_mem_list_lock);
+	error_bitmap = qdf_mem_header_untrack(header, current_domain);
 
 	qdf_mem_header_assert_valid(header, current_domain, error_bitmap,
 				    func, line);
@@ -1669,14 +1859,13 @@ qdf_export_symbol(qdf_mem_free_debug);
 void qdf_mem_check_for_leaks(void)
 {
 	enum qdf_debug_domain current_domain = qdf_debug_domain_get();
-	qdf_list_t *mem_list = qdf_mem_list_get(current_domain);
 	qdf_list_t *dma_list = qdf_mem_dma_list(current_domain);
 	uint32_t leaks_count = 0;
 
 	if (is_initial_mem_debug_disabled)
 		return;
 
-	leaks_count += qdf_mem_domain_check_for_leaks(current_domain, mem_list);
+	leaks_count += qdf_mem_shards_check_for_leaks(current_domain);
 	leaks_count += qdf_mem_domain_check_for_leaks(current_domain, dma_list);
 
 	if (leaks_count)
@@ -21,6 +21,7 @@
 
 #include <qdf_threads.h>
 #include <qdf_timer.h>
+#include <qdf_time.h>
 #include <scheduler_api.h>
 #include <qdf_list.h>
 
@@ -33,6 +34,8 @@
 #define SCHEDULER_NUMBER_OF_MSG_QUEUE 6
 #define SCHEDULER_WRAPPER_MAX_FAIL_COUNT (SCHEDULER_CORE_MAX_MESSAGES * 3)
 #define SCHEDULER_WATCHDOG_TIMEOUT (10 * 1000) /* 10s */
+/* Max messages dequeued from one queue before rescanning from queue 0 */
+#define SCHEDULER_MSG_BATCH_MAX 16
 
 #ifdef CONFIG_AP_PLATFORM
 #define SCHED_DEBUG_PANIC(msg)
@@ -108,6 +111,7 @@ struct scheduler_mq_ctx {
  * @timeout: timeout value for scheduler watchdog timer
  * @watchdog_timer: timer for triggering a scheduler watchdog bite
  * @watchdog_callback: the callback of the current msg being processed
+ * @watchdog_msg_ticks: system ticks when the current msg started processing
  */
 struct scheduler_ctx {
 	struct scheduler_mq_ctx queue_ctx;
@@ -126,6 +130,7 @@ struct scheduler_ctx {
 	uint32_t timeout;
 	qdf_timer_t watchdog_timer;
 	void *watchdog_callback;
+	qdf_time_t watchdog_msg_ticks;
 };
 
 /**
@@ -75,6 +75,19 @@ static inline void scheduler_watchdog_notify(struct scheduler_ctx *sched)
 static void scheduler_watchdog_timeout(void *arg)
 {
 	struct scheduler_ctx *sched = arg;
+	uint32_t elapsed_ms;
+
+	/*
+	 * The timer is armed once per batch of messages, only bite if the
+	 * message currently being processed has used up the whole timeout.
+	 */
+	elapsed_ms = qdf_system_ticks_to_msecs(qdf_system_ticks() -
+					       sched->watchdog_msg_ticks);
+	if (elapsed_ms < sched->timeout) {
+		qdf_timer_mod(&sched->watchdog_timer,
+			      sched->timeout - elapsed_ms);
+		return;
+	}
 
 	if (qdf_is_recovering()) {
 		sched_debug("Recovery is in progress ignore timeout");
@@ -281,6 +281,52 @@ struct scheduler_msg *scheduler_mq_get(struct scheduler_mq_type *msg_q)
 	return qdf_container_of(node, struct scheduler_msg, node);
 }
 
+/**
+ * scheduler_mq_get_batch() - dequeue up to @max messages from a queue
+ * @msg_q: message queue
+ * @msgs: filled with the dequeued messages, in queue order
+ * @max: number of entries in @msgs
+ *
+ * Return: number of messages dequeued
+ */
+static uint32_t scheduler_mq_get_batch(struct scheduler_mq_type *msg_q,
+				       struct scheduler_msg **msgs,
+				       uint32_t max)
+{
+	qdf_list_node_t *node;
+	uint32_t count = 0;
+
+	qdf_spin_lock_irqsave(&msg_q->mq_lock);
+	while (count < max &&
+	       QDF_IS_STATUS_SUCCESS(qdf_list_remove_front(&msg_q->mq_list,
+							   &node)))
+		msgs[count++] = qdf_container_of(node, struct scheduler_msg,
+						 node);
+	qdf_spin_unlock_irqrestore(&msg_q->mq_lock);
+
+	return count;
+}
+
+/**
+ * scheduler_mq_unget_batch() - return unprocessed messages to a queue
+ * @msg_q: message queue
+ * @msgs: messages dequeued by scheduler_mq_get_batch()
+ * @count: number of entries in @msgs
+ *
+ * The messages are put back at the front, in their original order.
+ *
+ * Return: None
+ */
+static void scheduler_mq_unget_batch(struct scheduler_mq_type *msg_q,
+				     struct scheduler_msg **msgs,
+				     uint32_t count)
+{
+	qdf_spin_lock_irqsave(&msg_q->mq_lock);
+	while (count)
+		qdf_list_insert_front(&msg_q->mq_list, &msgs[--count]->node);
+	qdf_spin_unlock_irqrestore(&msg_q->mq_lock);
+}
+
 QDF_STATUS scheduler_queues_deinit(struct scheduler_ctx *sched_ctx)
 {
 	return scheduler_all_queues_deinit(sched_ctx);
@@ -348,12 +394,49 @@ void scheduler_core_msg_free(struct scheduler_msg *msg)
 	qdf_atomic_dec(&__sched_queue_depth);
 }
 
+/*
+ * Per queue dequeue budget, indexed by queue priority. Lower priority
+ * queues get a smaller budget so they delay a newly posted higher
+ * priority message by a bounded number of messages only.
+ */
+static const uint8_t
+scheduler_batch_budget[SCHEDULER_NUMBER_OF_MSG_QUEUE] = {
+	SCHEDULER_MSG_BATCH_MAX,
+	SCHEDULER_MSG_BATCH_MAX,
+	SCHEDULER_MSG_BATCH_MAX / 2,
+	SCHEDULER_MSG_BATCH_MAX / 2,
+	SCHEDULER_MSG_BATCH_MAX / 4,
+	SCHEDULER_MSG_BATCH_MAX / 4,
+};
+
+static bool scheduler_thread_check_shutdown(struct scheduler_ctx *sch_ctx)
+{
+	/* Check if MC needs to shutdown */
+	if (!qdf_atomic_test_bit(MC_SHUTDOWN_EVENT_MASK,
+				 &sch_ctx->sch_event_flag))
+		return false;
+
+	sched_debug("scheduler thread signaled to shutdown");
+
+	/* Check for any Suspend Indication */
+	if (qdf_atomic_test_and_clear_bit(MC_SUSPEND_EVENT_MASK,
+					  &sch_ctx->sch_event_flag)) {
+		/* Unblock anyone waiting on suspend */
+		if (gp_sched_ctx->hdd_callback)
+			gp_sched_ctx->hdd_callback();
+	}
+
+	return true;
+}
+
 static void scheduler_thread_process_queues(struct scheduler_ctx *sch_ctx,
 					    bool *shutdown)
 {
 	int i;
 	QDF_STATUS status;
+	struct scheduler_msg *msgs[SCHEDULER_MSG_BATCH_MAX];
 	struct scheduler_msg *msg;
+	uint32_t count, idx;
 
 	if (!sch_ctx) {
 		QDF_DEBUG_PANIC("sch_ctx is null");
@@ -363,40 +446,50 @@ static void scheduler_thread_process_queues(struct scheduler_ctx *sch_ctx,
 	/* start with highest priority queue : timer queue at index 0 */
 	i = 0;
 	while (i < SCHEDULER_NUMBER_OF_MSG_QUEUE) {
-		/* Check if MC needs to shutdown */
-		if (qdf_atomic_test_bit(MC_SHUTDOWN_EVENT_MASK,
-					&sch_ctx->sch_event_flag)) {
-			sched_debug("scheduler thread signaled to shutdown");
+		if (scheduler_thread_check_shutdown(sch_ctx)) {
 			*shutdown = true;
-
-			/* Check for any Suspend Indication */
-			if (qdf_atomic_test_and_clear_bit(MC_SUSPEND_EVENT_MASK,
-						&sch_ctx->sch_event_flag)) {
-				/* Unblock anyone waiting on suspend */
-				if (gp_sched_ctx->hdd_callback)
-					gp_sched_ctx->hdd_callback();
-			}
-
 			break;
 		}
 
-		msg = scheduler_mq_get(&sch_ctx->queue_ctx.sch_msg_q[i]);
-		if (!msg) {
+		count = scheduler_mq_get_batch(&sch_ctx->queue_ctx.sch_msg_q[i],
+					       msgs, scheduler_batch_budget[i]);
+		if (!count) {
 			/* check next queue */
 			i++;
 			continue;
 		}
 
-		if (sch_ctx->queue_ctx.scheduler_msg_process_fn[i]) {
+		if (!sch_ctx->queue_ctx.scheduler_msg_process_fn[i]) {
+			/* start again with highest priority queue at index 0 */
+			i = 0;
+			continue;
+		}
+
+		/*
+		 * Arm the watchdog once for the whole batch, the timeout
+		 * handler checks how long the current message has been
+		 * running using watchdog_msg_ticks.
+		 */
+		sch_ctx->watchdog_msg_ticks = qdf_system_ticks();
+		qdf_timer_start(&sch_ctx->watchdog_timer, sch_ctx->timeout);
+
+		for (idx = 0; idx < count; idx++) {
+			if (idx && scheduler_thread_check_shutdown(sch_ctx)) {
+				*shutdown = true;
+				scheduler_mq_unget_batch(
+					&sch_ctx->queue_ctx.sch_msg_q[i],
+					&msgs[idx], count - idx);
+				break;
+			}
+
+			msg = msgs[idx];
 			sch_ctx->watchdog_msg_type = msg->type;
 			sch_ctx->watchdog_callback = msg->callback;
+			sch_ctx->watchdog_msg_ticks = qdf_system_ticks();
 
 			sched_history_start(msg);
-			qdf_timer_start(&sch_ctx->watchdog_timer,
-					sch_ctx->timeout);
 			status = sch_ctx->queue_ctx.
 					scheduler_msg_process_fn[i](msg);
-			qdf_timer_stop(&sch_ctx->watchdog_timer);
 			sched_history_stop();
 
 			if (QDF_IS_STATUS_ERROR(status))
@@ -406,6 +499,11 @@ static void scheduler_thread_process_queues(struct scheduler_ctx *sch_ctx,
 			scheduler_core_msg_free(msg);
 		}
 
+		qdf_timer_sync_cancel(&sch_ctx->watchdog_timer);
+
+		if (*shutdown)
+			break;
+
 		/* start again with highest priority queue at index 0 */
 		i = 0;
 	}
@@ -329,15 +329,19 @@ static void reg_modify_chan_list_for_dfs_channels(
  * reg_modify_chan_list_for_indoor_channels() - Disable the indoor channels if
  * indoor_chan_enabled flag is set to false.
  * @pdev_priv_obj: Pointer to regulatory private pdev structure.
+ * @start_chan: First channel enum to update.
+ * @end_chan: Last channel enum to update.
  */
 static void reg_modify_chan_list_for_indoor_channels(
-		struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj)
+		struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj,
+		enum channel_enum start_chan, enum channel_enum end_chan)
 {
 	enum channel_enum chan_enum;
 	struct regulatory_channel *chan_list = pdev_priv_obj->cur_chan_list;
 
 	if (!pdev_priv_obj->indoor_chan_enabled) {
-		for (chan_enum = 0; chan_enum < NUM_CHANNELS; chan_enum++) {
+		for (chan_enum = start_chan; chan_enum <= end_chan;
+		     chan_enum++) {
 			if (!(REGULATORY_CHAN_DISABLED &
 			      chan_list[chan_enum].chan_flags) &&
 			    (REGULATORY_CHAN_INDOOR_ONLY &
@@ -351,7 +355,8 @@ static void reg_modify_chan_list_for_indoor_channels(
 	}
 	if (pdev_priv_obj->force_ssc_disable_indoor_channel &&
 	    pdev_priv_obj->sap_state) {
-		for (chan_enum = 0; chan_enum < NUM_CHANNELS; chan_enum++) {
+		for (chan_enum = start_chan; chan_enum <= end_chan;
+		     chan_enum++) {
 			if (!(REGULATORY_CHAN_DISABLED &
 			      chan_list[chan_enum].chan_flags) &&
 			    (REGULATORY_CHAN_INDOOR_ONLY &
@@ -370,9 +375,12 @@ static void reg_modify_chan_list_for_indoor_channels(
  *channels for SAP operation based on the indoor concurrency list
  *
  * @pdev_priv_obj: Pointer to regulatory private pdev structure.
+ * @start_chan: First channel enum to update.
+ * @end_chan: Last channel enum to update.
  */
 static void reg_modify_chan_list_for_indoor_concurrency(
-		struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj)
+		struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj,
+		enum channel_enum start_chan, enum channel_enum end_chan)
 {
 	struct indoor_concurrency_list *indoor_list = NULL;
 	struct regulatory_channel *chan_list = pdev_priv_obj->cur_chan_list;
@@ -410,6 +418,9 @@ static void reg_modify_chan_list_for_indoor_concurrency(
 		if (min_enum == NUM_CHANNELS || max_enum == NUM_CHANNELS)
 			continue;
 
+		min_enum = QDF_MAX(min_enum, start_chan);
+		max_enum = QDF_MIN(max_enum, end_chan);
+
 		for (chan = min_enum; chan <= max_enum; chan++) {
 			if (chan_list[chan].chan_flags & REGULATORY_CHAN_INDOOR_ONLY &&
 			    !(chan_list[chan].chan_flags & REGULATORY_CHAN_DISABLED))
@@ -419,12 +430,14 @@ static void reg_modify_chan_list_for_indoor_concurrency(
 }
 #else
 static void reg_modify_chan_list_for_indoor_channels(
-		struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj)
+		struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj,
+		enum channel_enum start_chan, enum channel_enum end_chan)
 {
 }
 
 static void reg_modify_chan_list_for_indoor_concurrency(
-		struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj)
+		struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj,
+		enum channel_enum start_chan, enum channel_enum end_chan)
 {
 }
 #endif
@@ -495,16 +508,19 @@ static void reg_modify_chan_list_for_band(struct regulatory_channel *chan_list,
  * @chan_list: Pointer to regulatory channel list.
  * @set_fcc_channel: If this flag is set to true, then set the max FCC txpower
  * for channel 12 and 13.
+ * @start_chan: First channel enum to update.
+ * @end_chan: Last channel enum to update.
  */
 static void reg_modify_chan_list_for_fcc_channel(
-		struct regulatory_channel *chan_list, bool set_fcc_channel)
+		struct regulatory_channel *chan_list, bool set_fcc_channel,
+		enum channel_enum start_chan, enum channel_enum end_chan)
 {
 	enum channel_enum chan_enum;
 
 	if (!set_fcc_channel)
 		return;
 
-	for (chan_enum = 0; chan_enum < NUM_CHANNELS; chan_enum++) {
+	for (chan_enum = start_chan; chan_enum <= end_chan; chan_enum++) {
 		if (chan_list[chan_enum].center_freq == CHAN_12_CENT_FREQ)
 			chan_list[chan_enum].tx_power = MAX_PWR_FCC_CHAN_12;
 
@@ -518,16 +534,19 @@ static void reg_modify_chan_list_for_fcc_channel(
  * is set to false.
  * @chan_list: Pointer to regulatory channel list.
  * @en_chan_144: if false, then disable channel 144.
+ * @start_chan: First channel enum to update.
+ * @end_chan: Last channel enum to update.
  */
 static void reg_modify_chan_list_for_chan_144(
-		struct regulatory_channel *chan_list, bool en_chan_144)
+		struct regulatory_channel *chan_list, bool en_chan_144,
+		enum channel_enum start_chan, enum channel_enum end_chan)
 {
 	enum channel_enum chan_enum;
 
 	if (en_chan_144)
 		return;
 
-	for (chan_enum = 0; chan_enum < NUM_CHANNELS; chan_enum++) {
+	for (chan_enum = start_chan; chan_enum <= end_chan; chan_enum++) {
 		if (chan_list[chan_enum].center_freq == CHAN_144_CENT_FREQ) {
 			chan_list[chan_enum].chan_flags |=
 				REGULATORY_CHAN_DISABLED;
@@ -540,13 +559,16 @@ static void reg_modify_chan_list_for_chan_144(
  * reg_modify_chan_list_for_nol_list() - Disable the channel if nol_chan flag is
  * set.
  * @chan_list: Pointer to regulatory channel list.
+ * @start_chan: First channel enum to update.
+ * @end_chan: Last channel enum to update.
  */
 static void reg_modify_chan_list_for_nol_list(
-		struct regulatory_channel *chan_list)
+		struct regulatory_channel *chan_list,
+		enum channel_enum start_chan, enum channel_enum end_chan)
 {
 	enum channel_enum chan_enum;
 
-	for (chan_enum = 0; chan_enum < NUM_CHANNELS; chan_enum++) {
+	for (chan_enum = start_chan; chan_enum <= end_chan; chan_enum++) {
 		if (chan_list[chan_enum].nol_chan) {
 			chan_list[chan_enum].state = CHANNEL_STATE_DISABLE;
 			chan_list[chan_enum].chan_flags |=
@@ -798,10 +820,13 @@ void reg_init_pdev_mas_chan_list(
  * non-zero, then disable the pdev channels which is given in
  * cache_disable_chan_list.
  * @pdev_priv_obj: Pointer to regulatory pdev private object.
+ * @start_chan: First channel enum to update.
+ * @end_chan: Last channel enum to update.
  */
 #ifdef DISABLE_CHANNEL_LIST
 static void reg_modify_chan_list_for_cached_channels(
-		struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj)
+		struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj,
+		enum channel_enum start_chan, enum channel_enum end_chan)
 {
 	uint32_t i, j;
 	uint32_t num_cache_channels = pdev_priv_obj->num_cache_channels;
@@ -816,7 +841,7 @@ static void reg_modify_chan_list_for_cached_channels(
 
 	if (pdev_priv_obj->disable_cached_channels) {
 		for (i = 0; i < num_cache_channels; i++) {
-			for (j = 0; j < NUM_CHANNELS; j++) {
+			for (j = start_chan; j <= end_chan; j++) {
 				if (cache_chan_list[i].center_freq ==
 				    cur_chan_list[j].center_freq) {
 					cur_chan_list[j].state =
@@ -837,7 +862,8 @@ static void reg_modify_chan_list_for_cached_channels(
 }
 #else
 static void reg_modify_chan_list_for_cached_channels(
-		struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj)
+		struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj,
+		enum channel_enum start_chan, enum channel_enum end_chan)
 {
 }
 #endif
@@ -847,13 +873,17 @@ static void reg_modify_chan_list_for_cached_channels(
  * reg_modify_chan_list_for_srd_channels() - Modify SRD channels in ETSI13
  * @pdev: Pointer to pdev object
  * @chan_list: Current channel list
+ * @start_chan: First channel enum to update.
+ * @end_chan: Last channel enum to update.
  *
  * This function converts SRD channels to passive in ETSI13 regulatory domain
  * when enable_srd_chan_in_master_mode is not set.
  */
 static void
 reg_modify_chan_list_for_srd_channels(struct wlan_objmgr_pdev *pdev,
-				      struct regulatory_channel *chan_list)
+				      struct regulatory_channel *chan_list,
+				      enum channel_enum start_chan,
+				      enum channel_enum end_chan)
 {
 	enum channel_enum chan_enum;
 
@@ -863,7 +893,7 @@ reg_modify_chan_list_for_srd_channels(struct wlan_objmgr_pdev *pdev,
 	if (reg_is_etsi13_srd_chan_allowed_master_mode(pdev))
 		return;
 
-	for (chan_enum = 0; chan_enum < NUM_CHANNELS; chan_enum++) {
+	for (chan_enum = start_chan; chan_enum <= end_chan; chan_enum++) {
 		if (chan_list[chan_enum].chan_flags & REGULATORY_CHAN_DISABLED)
 			continue;
 
@@ -880,7 +910,9 @@ reg_modify_chan_list_for_srd_channels(struct wlan_objmgr_pdev *pdev,
 #else
 static inline void
 reg_modify_chan_list_for_srd_channels(struct wlan_objmgr_pdev *pdev,
-				      struct regulatory_channel *chan_list)
+				      struct regulatory_channel *chan_list,
+				      enum channel_enum start_chan,
+				      enum channel_enum end_chan)
 {
 }
 #endif
@@ -915,6 +947,8 @@ reg_is_disabling_5dot9_needed(struct wlan_objmgr_psoc *psoc)
  * in FCC
  * @pdev: Pointer to pdev object
  * @chan_list: Current channel list
+ * @start_chan: First channel enum to update.
+ * @end_chan: Last channel enum to update.
  *
  * This function disables 5.9 GHz channels if service bit
  * wmi_service_5dot9_ghz_support is not set or the reg db is not offloaded
@@ -925,7 +959,9 @@ reg_is_disabling_5dot9_needed(struct wlan_objmgr_psoc *psoc)
 static void
 reg_modify_chan_list_for_5dot9_ghz_channels(struct wlan_objmgr_pdev *pdev,
 					    struct regulatory_channel
-					    *chan_list)
+					    *chan_list,
+					    enum channel_enum start_chan,
+					    enum channel_enum end_chan)
 {
 	enum channel_enum chan_enum;
 	struct wlan_objmgr_psoc *psoc;
@@ -936,7 +972,8 @@ reg_modify_chan_list_for_5dot9_ghz_channels(struct wlan_objmgr_pdev *pdev,
 		return;
 
 	if (reg_is_disabling_5dot9_needed(psoc)) {
-		for (chan_enum = 0; chan_enum < NUM_CHANNELS; chan_enum++) {
+		for (chan_enum = start_chan; chan_enum <= end_chan;
+		     chan_enum++) {
 			if (reg_is_5dot9_ghz_freq(pdev, chan_list[chan_enum].
 						  center_freq)) {
 				chan_list[chan_enum].state =
@@ -951,7 +988,7 @@ reg_modify_chan_list_for_5dot9_ghz_channels(struct wlan_objmgr_pdev *pdev,
 	if (reg_is_5dot9_ghz_chan_allowed_master_mode(pdev))
 		return;
 
-	for (chan_enum = 0; chan_enum < NUM_CHANNELS; chan_enum++) {
+	for (chan_enum = start_chan; chan_enum <= end_chan; chan_enum++) {
 		if (chan_list[chan_enum].chan_flags & REGULATORY_CHAN_DISABLED)
 			continue;
 
@@ -971,6 +1008,8 @@ reg_modify_chan_list_for_5dot9_ghz_channels(struct wlan_objmgr_pdev *pdev,
  *
  * @pdev: Pointer to pdev object
  * @chan_list: Current channel list
+ * @start_chan: First channel enum to update.
+ * @end_chan: Last channel enum to update.
  *
  * This function disables lower 6G edge channel (5935MHz) if service bit
  * wmi_service_lower_6g_edge_ch_supp is not set. If service bit is set
@@ -982,19 +1021,26 @@ reg_modify_chan_list_for_5dot9_ghz_channels(struct wlan_objmgr_pdev *pdev,
 static void
 reg_modify_chan_list_for_6g_edge_channels(struct wlan_objmgr_pdev *pdev,
 					  struct regulatory_channel
-					  *chan_list)
+					  *chan_list,
+					  enum channel_enum start_chan,
+					  enum channel_enum end_chan)
 {
 	struct wlan_objmgr_psoc *psoc;
 
+	if (end_chan < CHAN_ENUM_5935 || start_chan > CHAN_ENUM_7115)
+		return;
+
 	psoc = wlan_pdev_get_psoc(pdev);
 
-	if (!reg_is_lower_6g_edge_ch_supp(psoc)) {
+	if (start_chan <= CHAN_ENUM_5935 &&
+	    !reg_is_lower_6g_edge_ch_supp(psoc)) {
 		chan_list[CHAN_ENUM_5935].state = CHANNEL_STATE_DISABLE;
 		chan_list[CHAN_ENUM_5935].chan_flags |=
 						REGULATORY_CHAN_DISABLED;
 	}
 
-	if (reg_is_upper_6g_edge_ch_disabled(psoc)) {
+	if (end_chan >= CHAN_ENUM_7115 &&
+	    reg_is_upper_6g_edge_ch_disabled(psoc)) {
 		chan_list[CHAN_ENUM_7115].state = CHANNEL_STATE_DISABLE;
 		chan_list[CHAN_ENUM_7115].chan_flags |=
 						REGULATORY_CHAN_DISABLED;
@@ -1004,7 +1050,9 @@ reg_modify_chan_list_for_6g_edge_channels(struct wlan_objmgr_pdev *pdev,
 static inline void
 reg_modify_chan_list_for_6g_edge_channels(struct wlan_objmgr_pdev *pdev,
 					  struct regulatory_channel
-					  *chan_list)
+					  *chan_list,
+					  enum channel_enum start_chan,
+					  enum channel_enum end_chan)
 {
 }
 #endif
@@ -1276,10 +1324,13 @@ reg_append_mas_chan_list_for_6g(struct wlan_regulatory_pdev_priv_obj
 
 static void
 reg_populate_secondary_cur_chan_list(struct wlan_regulatory_pdev_priv_obj
-				     *pdev_priv_obj)
+				     *pdev_priv_obj,
+				     enum channel_enum start_chan,
+				     enum channel_enum end_chan)
 {
 	struct wlan_objmgr_psoc *psoc;
 	struct wlan_lmac_if_reg_tx_ops *reg_tx_ops;
+	enum channel_enum last_non_6g, first_6g;
 
 	psoc = wlan_pdev_get_psoc(pdev_priv_obj->pdev_ptr);
 	if (!psoc) {
@@ -1294,20 +1345,27 @@ reg_populate_secondary_cur_chan_list(struct wlan_regulatory_pdev_priv_obj
 	}
 	if (reg_tx_ops->register_master_ext_handler &&
 	    wlan_psoc_nif_fw_ext_cap_get(psoc, WLAN_SOC_EXT_EVENT_SUPPORTED)) {
-		qdf_mem_copy(pdev_priv_obj->secondary_cur_chan_list,
-			     pdev_priv_obj->cur_chan_list,
-			     (NUM_CHANNELS - NUM_6GHZ_CHANNELS) *
-			     sizeof(struct regulatory_channel));
+		last_non_6g = QDF_MIN(end_chan, MIN_6GHZ_CHANNEL - 1);
+		if (start_chan <= last_non_6g)
+			qdf_mem_copy(&pdev_priv_obj->
+				     secondary_cur_chan_list[start_chan],
+				     &pdev_priv_obj->cur_chan_list[start_chan],
+				     (last_non_6g - start_chan + 1) *
+				     sizeof(struct regulatory_channel));
 
-		qdf_mem_copy(&pdev_priv_obj->
-		     secondary_cur_chan_list[MIN_6GHZ_CHANNEL],
-		     pdev_priv_obj->mas_chan_list_6g_ap
-		     [pdev_priv_obj->reg_cur_6g_ap_pwr_type],
-		     NUM_6GHZ_CHANNELS * sizeof(struct regulatory_channel));
+		first_6g = QDF_MAX(start_chan, MIN_6GHZ_CHANNEL);
+		if (first_6g <= end_chan)
+			qdf_mem_copy(&pdev_priv_obj->
+				     secondary_cur_chan_list[first_6g],
+				     &pdev_priv_obj->mas_chan_list_6g_ap
+				     [pdev_priv_obj->reg_cur_6g_ap_pwr_type]
+				     [first_6g - MIN_6GHZ_CHANNEL],
+				     (end_chan - first_6g + 1) *
+				     sizeof(struct regulatory_channel));
 	} else {
-		qdf_mem_copy(pdev_priv_obj->secondary_cur_chan_list,
-			     pdev_priv_obj->cur_chan_list,
-			     (NUM_CHANNELS) *
+		qdf_mem_copy(&pdev_priv_obj->secondary_cur_chan_list[start_chan],
+			     &pdev_priv_obj->cur_chan_list[start_chan],
+			     (end_chan - start_chan + 1) *
 			     sizeof(struct regulatory_channel));
 	}
 }
@@ -1370,7 +1428,9 @@ reg_append_mas_chan_list_for_6g(struct wlan_regulatory_pdev_priv_obj
 
 static inline void
 reg_populate_secondary_cur_chan_list(struct wlan_regulatory_pdev_priv_obj
-				     *pdev_priv_obj)
+				     *pdev_priv_obj,
+				     enum channel_enum start_chan,
+				     enum channel_enum end_chan)
 {
 }
 #endif /* CONFIG_REG_CLIENT */
@@ -1454,16 +1514,21 @@ reg_append_mas_chan_list_for_6g(
 #ifdef CONFIG_REG_CLIENT
 static void
 reg_populate_secondary_cur_chan_list(struct wlan_regulatory_pdev_priv_obj
-				     *pdev_priv_obj)
+				     *pdev_priv_obj,
+				     enum channel_enum start_chan,
+				     enum channel_enum end_chan)
 {
-	qdf_mem_copy(pdev_priv_obj->secondary_cur_chan_list,
-		     pdev_priv_obj->mas_chan_list,
-		     NUM_CHANNELS * sizeof(struct regulatory_channel));
+	qdf_mem_copy(&pdev_priv_obj->secondary_cur_chan_list[start_chan],
+		     &pdev_priv_obj->mas_chan_list[start_chan],
+		     (end_chan - start_chan + 1) *
+		     sizeof(struct regulatory_channel));
 }
 #else /* CONFIG_REG_CLIENT */
 static inline void
 reg_populate_secondary_cur_chan_list(struct wlan_regulatory_pdev_priv_obj
-				     *pdev_priv_obj)
+				     *pdev_priv_obj,
+				     enum channel_enum start_chan,
+				     enum channel_enum end_chan)
 {
 }
 #endif /* CONFIG_REG_CLIENT */
@@ -1630,6 +1695,8 @@ reg_modify_5g_maxbw(struct regulatory_channel *chan,
  * reg_modify_chan_list_for_avoid_chan_ext() - Update the state and bandwidth
  * for each channel in the current channel list.
  * @pdev_priv_obj: Pointer to wlan regulatory pdev private object.
+ * @start_chan: First channel enum to update.
+ * @end_chan: Last channel enum to update.
  *
  * This function update the state and bandwidth for each channel in the current
  * channel list if it is affected by avoid frequency list.
@@ -1645,7 +1712,9 @@ reg_modify_5g_maxbw(struct regulatory_channel *chan,
  */
 static void
 reg_modify_chan_list_for_avoid_chan_ext(struct wlan_regulatory_pdev_priv_obj
-				     *pdev_priv_obj)
+				     *pdev_priv_obj,
+				     enum channel_enum start_chan,
+				     enum channel_enum end_chan)
 {
 	uint32_t i, j, k;
 	struct wlan_objmgr_psoc *psoc;
@@ -1682,7 +1751,7 @@ reg_modify_chan_list_for_avoid_chan_ext(struct wlan_regulatory_pdev_priv_obj
 	avoid_freq_ext = psoc_priv_obj->avoid_freq_ext_list.avoid_freq_range;
 
 	for (i = 0; i < num_avoid_channels; i++)
-		for (j = 0; j < NUM_CHANNELS; j++) {
+		for (j = start_chan; j <= end_chan; j++) {
 			qdf_freq_t c_freq, avoid_tmp = avoid_chan_ext_list[i];
 
 			if (chan_list[j].state == CHANNEL_STATE_DISABLE)
@@ -1797,14 +1866,141 @@ second_chan_handle:
 			}
 		}
 }
+
+/**
+ * reg_is_avoid_chan_ext_active() - Whether the avoid_chan_ext pass would
+ * change the current channel list.
+ * @pdev_priv_obj: Pointer to wlan regulatory pdev private object.
+ *
+ * The psoc ch_avoid_ext_ind flag is cleared once the indication has been
+ * delivered, without a recompute, so the range rebuild uses this to detect
+ * that the cached base list was built with a different avoid state.
+ *
+ * Return: true if reg_modify_chan_list_for_avoid_chan_ext() is not a no-op.
+ */
+static bool
+reg_is_avoid_chan_ext_active(struct wlan_regulatory_pdev_priv_obj
+			     *pdev_priv_obj)
+{
+	struct wlan_objmgr_psoc *psoc;
+	struct wlan_regulatory_psoc_priv_obj *psoc_priv_obj;
+
+	psoc = wlan_pdev_get_psoc(pdev_priv_obj->pdev_ptr);
+	if (!psoc)
+		return false;
+
+	if (!reg_check_coex_unsafe_chan_reg_disable(psoc))
+		return false;
+
+	psoc_priv_obj = reg_get_psoc_obj(psoc);
+	if (!psoc_priv_obj)
+		return false;
+
+	return pdev_priv_obj->avoid_chan_ext_list.chan_cnt &&
+	       psoc_priv_obj->ch_avoid_ext_ind;
+}
+
+static inline void
+reg_save_avoid_chan_ext_state(struct wlan_regulatory_pdev_priv_obj
+			      *pdev_priv_obj)
+{
+	pdev_priv_obj->base_avoid_chan_ext_active =
+		reg_is_avoid_chan_ext_active(pdev_priv_obj);
+}
+
+static inline bool
+reg_is_avoid_chan_ext_state_changed(struct wlan_regulatory_pdev_priv_obj
+				    *pdev_priv_obj)
+{
+	return pdev_priv_obj->base_avoid_chan_ext_active !=
+	       reg_is_avoid_chan_ext_active(pdev_priv_obj);
+}
 #else
 static inline void
 reg_modify_chan_list_for_avoid_chan_ext(struct wlan_regulatory_pdev_priv_obj
-				     *pdev_priv_obj)
+				     *pdev_priv_obj,
+				     enum channel_enum start_chan,
+				     enum channel_enum end_chan)
+{
+}
+
+static inline void
+reg_save_avoid_chan_ext_state(struct wlan_regulatory_pdev_priv_obj
+			      *pdev_priv_obj)
+{
+}
+
+static inline bool
+reg_is_avoid_chan_ext_state_changed(struct wlan_regulatory_pdev_priv_obj
+				    *pdev_priv_obj)
 {
+	return false;
 }
 #endif
 
+/**
+ * reg_apply_chan_list_overrides() - Apply the per-channel overrides that
+ * depend on the NOL state to the current channel list.
+ * @pdev_priv_obj: Pointer to regulatory pdev private object.
+ * @start_chan: First channel enum to update.
+ * @end_chan: Last channel enum to update.
+ *
+ * Every pass here only reads and writes the channels inside the given range,
+ * so a NOL change for a handful of channels can be applied without walking
+ * the whole list.
+ *
+ * Return: void.
+ */
+static void
+reg_apply_chan_list_overrides(struct wlan_regulatory_pdev_priv_obj
+			      *pdev_priv_obj,
+			      enum channel_enum start_chan,
+			      enum channel_enum end_chan)
+{
+	reg_modify_chan_list_for_nol_list(pdev_priv_obj->cur_chan_list,
+					  start_chan, end_chan);
+
+	reg_modify_chan_list_for_indoor_channels(pdev_priv_obj,
+						 start_chan, end_chan);
+
+	reg_modify_chan_list_for_indoor_concurrency(pdev_priv_obj,
+						    start_chan, end_chan);
+
+	reg_modify_chan_list_for_fcc_channel(pdev_priv_obj->cur_chan_list,
+					     pdev_priv_obj->set_fcc_channel,
+					     start_chan, end_chan);
+
+	reg_modify_chan_list_for_chan_144(pdev_priv_obj->cur_chan_list,
+					  pdev_priv_obj->en_chan_144,
+					  start_chan, end_chan);
+
+	reg_modify_chan_list_for_srd_channels(pdev_priv_obj->pdev_ptr,
+					      pdev_priv_obj->cur_chan_list,
+					      start_chan, end_chan);
+
+	reg_modify_chan_list_for_5dot9_ghz_channels(pdev_priv_obj->pdev_ptr,
+						    pdev_priv_obj->
+						    cur_chan_list,
+						    start_chan, end_chan);
+
+	reg_modify_chan_list_for_max_chwidth(pdev_priv_obj->pdev_ptr,
+					     pdev_priv_obj->cur_chan_list);
+
+	reg_modify_chan_list_for_6g_edge_channels(pdev_priv_obj->pdev_ptr,
+						  pdev_priv_obj->
+						  cur_chan_list,
+						  start_chan, end_chan);
+
+	reg_populate_secondary_cur_chan_list(pdev_priv_obj,
+					     start_chan, end_chan);
+
+	reg_modify_chan_list_for_cached_channels(pdev_priv_obj,
+						 start_chan, end_chan);
+
+	reg_modify_chan_list_for_avoid_chan_ext(pdev_priv_obj,
+						start_chan, end_chan);
+}
+
 void reg_compute_pdev_current_chan_list(struct wlan_regulatory_pdev_priv_obj
 					*pdev_priv_obj)
 {
@@ -1829,37 +2025,64 @@ void reg_compute_pdev_current_chan_list(struct wlan_regulatory_pdev_priv_obj
 	reg_modify_chan_list_for_dfs_channels(pdev_priv_obj->cur_chan_list,
 					      pdev_priv_obj->dfs_enabled);
 
-	reg_modify_chan_list_for_nol_list(pdev_priv_obj->cur_chan_list);
-
-	reg_modify_chan_list_for_indoor_channels(pdev_priv_obj);
-
-	reg_modify_chan_list_for_indoor_concurrency(pdev_priv_obj);
-
-	reg_modify_chan_list_for_fcc_channel(pdev_priv_obj->cur_chan_list,
-					     pdev_priv_obj->set_fcc_channel);
-
-	reg_modify_chan_list_for_chan_144(pdev_priv_obj->cur_chan_list,
-					  pdev_priv_obj->en_chan_144);
+	qdf_mem_copy(pdev_priv_obj->base_chan_list,
+		     pdev_priv_obj->cur_chan_list,
+		     NUM_CHANNELS * sizeof(struct regulatory_channel));
+	pdev_priv_obj->base_chan_list_valid = true;
+	reg_save_avoid_chan_ext_state(pdev_priv_obj);
 
-	reg_modify_chan_list_for_srd_channels(pdev_priv_obj->pdev_ptr,
-					      pdev_priv_obj->cur_chan_list);
+	reg_apply_chan_list_overrides(pdev_priv_obj, 0, NUM_CHANNELS - 1);
+}
 
-	reg_modify_chan_list_for_5dot9_ghz_channels(pdev_priv_obj->pdev_ptr,
-						    pdev_priv_obj->
-						    cur_chan_list);
+#ifdef CONFIG_HOST_FIND_CHAN
+static inline bool reg_is_chan_list_range_update_supported(void)
+{
+	return false;
+}
+#else
+static inline bool reg_is_chan_list_range_update_supported(void)
+{
+	return true;
+}
+#endif
 
-	reg_modify_chan_list_for_max_chwidth(pdev_priv_obj->pdev_ptr,
-					     pdev_priv_obj->cur_chan_list);
+void
+reg_compute_pdev_current_chan_list_range(struct wlan_regulatory_pdev_priv_obj
+					 *pdev_priv_obj,
+					 enum channel_enum start_chan,
+					 enum channel_enum end_chan)
+{
+	enum channel_enum chan_enum;
+	struct regulatory_channel *base_chan_list;
 
-	reg_modify_chan_list_for_6g_edge_channels(pdev_priv_obj->pdev_ptr,
-						  pdev_priv_obj->
-						  cur_chan_list);
+	/*
+	 * The max chwidth pass works on the whole list and the 6 GHz part of
+	 * mas_chan_list is rebuilt from the per power type lists, so both of
+	 * those still need the full rebuild. The same goes for a change of
+	 * any override input since the base list was cached.
+	 */
+	if (!pdev_priv_obj->base_chan_list_valid ||
+	    reg_is_avoid_chan_ext_state_changed(pdev_priv_obj) ||
+	    !reg_is_chan_list_range_update_supported() ||
+	    start_chan > end_chan || end_chan >= MIN_6GHZ_CHANNEL) {
+		reg_compute_pdev_current_chan_list(pdev_priv_obj);
+		return;
+	}
 
-	reg_populate_secondary_cur_chan_list(pdev_priv_obj);
+	base_chan_list = pdev_priv_obj->base_chan_list;
+	for (chan_enum = start_chan; chan_enum <= end_chan; chan_enum++) {
+		base_chan_list[chan_enum].nol_chan =
+			pdev_priv_obj->mas_chan_list[chan_enum].nol_chan;
+		base_chan_list[chan_enum].nol_history =
+			pdev_priv_obj->mas_chan_list[chan_enum].nol_history;
+	}
 
-	reg_modify_chan_list_for_cached_channels(pdev_priv_obj);
+	qdf_mem_copy(&pdev_priv_obj->cur_chan_list[start_chan],
+		     &base_chan_list[start_chan],
+		     (end_chan - start_chan + 1) *
+		     sizeof(struct regulatory_channel));
 
-	reg_modify_chan_list_for_avoid_chan_ext(pdev_priv_obj);
+	reg_apply_chan_list_overrides(pdev_priv_obj, start_chan, end_chan);
 }
 
 void reg_reset_reg_rules(struct reg_rule_info *reg_rules)
@@ -76,6 +76,22 @@ reg_save_reg_rules_to_pdev(struct reg_rule_info *psoc_reg_rules,
 void reg_compute_pdev_current_chan_list(
 		struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj);
 
+/**
+ * reg_compute_pdev_current_chan_list_range() - Recompute a range of the pdev
+ * current channel list after a NOL change.
+ * @pdev_priv_obj: Pointer to regdb pdev private object.
+ * @start_chan: First channel enum whose NOL state changed.
+ * @end_chan: Last channel enum whose NOL state changed.
+ *
+ * Only the NOL state of the given channels may have changed since the last
+ * reg_compute_pdev_current_chan_list(); any other configuration change must
+ * go through the full compute. Falls back to the full compute when the
+ * cached base list is not valid or the range covers 6 GHz channels.
+ */
+void reg_compute_pdev_current_chan_list_range(
+		struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj,
+		enum channel_enum start_chan, enum channel_enum end_chan);
+
 /**
  * reg_propagate_mas_chan_list_to_pdev() - Propagate master channel list to pdev
  * @psoc: Pointer to psoc object.
@@ -212,6 +212,10 @@ struct wlan_regulatory_psoc_priv_obj {
  * situations
  * @mas_chan_list: master channel list
  * from the firmware.
+ * @base_chan_list: current channel list before the NOL dependent passes,
+ * used to recompute only the channels touched by a NOL update
+ * @base_chan_list_valid: whether @base_chan_list matches the current config,
+ * cleared by every setter of an override input that does not recompute
  * @is_6g_channel_list_populated: indicates the channel lists are populated
  * @mas_chan_list_6g_ap: master channel list for 6G AP, includes all power types
  * @mas_chan_list_6g_client: master channel list for 6G client, includes
@@ -229,6 +233,8 @@ struct wlan_regulatory_psoc_priv_obj {
  * @max_phymode: The maximum phymode supported by the device and regulatory.
  * @max_chwidth: The maximum bandwidth corresponding to the maximum phymode.
  * @avoid_chan_ext_list: the extended avoid frequency list.
+ * @base_avoid_chan_ext_active: whether the avoid_chan_ext pass was active
+ * when @base_chan_list was cached
  * @afc_cb_lock: The spinlock to synchronize afc callbacks
  * @afc_cb_obj: The object containing the callback function and opaque argument
  * @afc_request_id: The last AFC request id received from FW/halphy
@@ -252,6 +258,8 @@ struct wlan_regulatory_pdev_priv_obj {
 	struct regulatory_channel secondary_cur_chan_list[NUM_CHANNELS];
 #endif
 	struct regulatory_channel mas_chan_list[NUM_CHANNELS];
+	struct regulatory_channel base_chan_list[NUM_CHANNELS];
+	bool base_chan_list_valid;
 #ifdef CONFIG_BAND_6GHZ
 	bool is_6g_channel_list_populated;
 	struct regulatory_channel mas_chan_list_6g_ap[REG_CURRENT_MAX_AP_TYPE][NUM_6GHZ_CHANNELS];
@@ -304,6 +312,7 @@ struct wlan_regulatory_pdev_priv_obj {
 #endif
 #ifdef FEATURE_WLAN_CH_AVOID_EXT
 	avoid_ch_ext_list avoid_chan_ext_list;
+	bool base_avoid_chan_ext_active;
 #endif
 #ifdef CONFIG_AFC_SUPPORT
 	qdf_spinlock_t afc_cb_lock;
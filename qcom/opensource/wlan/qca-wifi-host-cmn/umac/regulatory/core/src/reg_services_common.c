@@ -1675,6 +1675,7 @@ QDF_STATUS reg_program_chan_list(struct wlan_objmgr_pdev *pdev,
 			pdev_priv_obj->indoor_chan_enabled = false;
 		else
 			pdev_priv_obj->indoor_chan_enabled = true;
+		pdev_priv_obj->base_chan_list_valid = false;
 
 		pdev_id = wlan_objmgr_pdev_get_pdev_id(pdev);
 		tx_ops = reg_get_psoc_tx_ops(psoc);
@@ -4640,7 +4641,7 @@ void reg_update_nol_ch_for_freq(struct wlan_objmgr_pdev *pdev,
 				uint8_t num_chan,
 				bool nol_chan)
 {
-	enum channel_enum chan_enum;
+	enum channel_enum chan_enum, min_enum = NUM_CHANNELS, max_enum = 0;
 	struct regulatory_channel *mas_chan_list = NULL, *psoc_mas_chan_list;
 	struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj;
 	struct wlan_objmgr_psoc *psoc;
@@ -4671,6 +4672,8 @@ void reg_update_nol_ch_for_freq(struct wlan_objmgr_pdev *pdev,
 			mas_chan_list[chan_enum].nol_chan = nol_chan;
 		if (psoc_mas_chan_list)
 			psoc_mas_chan_list[chan_enum].nol_chan = nol_chan;
+		min_enum = QDF_MIN(min_enum, chan_enum);
+		max_enum = QDF_MAX(max_enum, chan_enum);
 	}
 
 	if (!pdev_priv_obj) {
@@ -4678,7 +4681,11 @@ void reg_update_nol_ch_for_freq(struct wlan_objmgr_pdev *pdev,
 		return;
 	}
 
-	reg_compute_pdev_current_chan_list(pdev_priv_obj);
+	if (min_enum > max_enum)
+		reg_compute_pdev_current_chan_list(pdev_priv_obj);
+	else
+		reg_compute_pdev_current_chan_list_range(pdev_priv_obj,
+							 min_enum, max_enum);
 
 	reg_send_scheduler_msg_sb(psoc, pdev);
 }
@@ -5134,6 +5141,7 @@ reg_add_indoor_concurrency(struct wlan_objmgr_pdev *pdev, uint8_t vdev_id,
 			list->freq = freq;
 			list->vdev_id = vdev_id;
 			list->chan_range = range;
+			pdev_priv_obj->base_chan_list_valid = false;
 			reg_debug("Added freq %d vdev %d width %d at idx %d",
 				  freq, vdev_id, width, i);
 			return QDF_STATUS_SUCCESS;
@@ -5167,6 +5175,7 @@ reg_remove_indoor_concurrency(struct wlan_objmgr_pdev *pdev, uint8_t vdev_id,
 			list->freq = 0;
 			list->vdev_id = INVALID_VDEV_ID;
 			list->chan_range = NULL;
+			pdev_priv_obj->base_chan_list_valid = false;
 			return QDF_STATUS_SUCCESS;
 		}
 		continue;
@@ -5195,6 +5204,7 @@ reg_set_cur_6g_ap_pwr_type(struct wlan_objmgr_pdev *pdev,
 	}
 	/* should we validate the input reg_cur_6g_ap_type? */
 	pdev_priv_obj->reg_cur_6g_ap_pwr_type = reg_cur_6g_ap_pwr_type;
+	pdev_priv_obj->base_chan_list_valid = false;
 	return QDF_STATUS_SUCCESS;
 }
 
@@ -769,6 +769,7 @@ QDF_STATUS reg_cache_channel_freq_state(struct wlan_objmgr_pdev *pdev,
 		}
 	}
 	pdev_priv_obj->num_cache_channels = num_channels;
+	pdev_priv_obj->base_chan_list_valid = false;
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2023 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "qdf_mem.h"
+#include "qdf_trace.h"
+#include "qdf_types.h"
+#include "qdf_util.h"
+#include "wlan_objmgr_global_obj.h"
+#include "wlan_objmgr_psoc_obj.h"
+#include "reg_priv_objs.h"
+#include "reg_build_chan_list.h"
+#include "reg_services_common.h"
+#include "reg_utils.h"
+#include "reg_build_chan_list_test.h"
+
+#define reg_chan_list_ut_iterations 256
+#define reg_chan_list_ut_max_span 4
+
+static uint32_t reg_chan_list_ut_rand(uint32_t range)
+{
+	uint32_t val;
+
+	qdf_get_random_bytes(&val, sizeof(val));
+
+	return val % range;
+}
+
+static uint32_t
+reg_chan_list_ut_compare(struct wlan_regulatory_pdev_priv_obj *full,
+			 struct wlan_regulatory_pdev_priv_obj *incr,
+			 uint32_t iter)
+{
+	uint32_t errors = 0;
+
+	if (qdf_mem_cmp(full->cur_chan_list, incr->cur_chan_list,
+			sizeof(full->cur_chan_list))) {
+		qdf_nofl_alert("FAIL: iteration %u: cur_chan_list mismatch",
+			       iter);
+		errors++;
+	}
+
+#ifdef CONFIG_REG_CLIENT
+	if (qdf_mem_cmp(full->secondary_cur_chan_list,
+			incr->secondary_cur_chan_list,
+			sizeof(full->secondary_cur_chan_list))) {
+		qdf_nofl_alert("FAIL: iteration %u: secondary list mismatch",
+			       iter);
+		errors++;
+	}
+#endif
+
+	return errors;
+}
+
+static void
+reg_chan_list_ut_toggle_nol(struct wlan_regulatory_pdev_priv_obj *obj,
+			    enum channel_enum start_chan,
+			    enum channel_enum end_chan,
+			    bool nol_chan, bool nol_history)
+{
+	enum channel_enum chan_enum;
+
+	for (chan_enum = start_chan; chan_enum <= end_chan; chan_enum++) {
+		obj->mas_chan_list[chan_enum].nol_chan = nol_chan;
+		obj->mas_chan_list[chan_enum].nol_history = nol_history;
+		obj->cur_chan_list[chan_enum].nol_history = nol_history;
+	}
+}
+
+static uint32_t
+reg_chan_list_ut_range_vs_full(struct wlan_regulatory_pdev_priv_obj *pdev_obj)
+{
+	struct wlan_regulatory_pdev_priv_obj *full, *incr;
+	enum channel_enum start_chan, end_chan;
+	bool nol_chan, nol_history;
+	uint32_t errors = 0;
+	uint32_t i;
+
+	full = qdf_mem_malloc(sizeof(*full));
+	if (!full)
+		return 1;
+
+	incr = qdf_mem_malloc(sizeof(*incr));
+	if (!incr) {
+		qdf_mem_free(full);
+		return 1;
+	}
+
+	qdf_mem_copy(full, pdev_obj, sizeof(*full));
+	reg_compute_pdev_current_chan_list(full);
+	qdf_mem_copy(incr, full, sizeof(*incr));
+
+	for (i = 0; i < reg_chan_list_ut_iterations; i++) {
+		start_chan = reg_chan_list_ut_rand(MIN_6GHZ_CHANNEL);
+		end_chan = QDF_MIN(start_chan +
+				   reg_chan_list_ut_rand(
+					reg_chan_list_ut_max_span),
+				   MIN_6GHZ_CHANNEL - 1);
+		nol_chan = reg_chan_list_ut_rand(2);
+		nol_history = reg_chan_list_ut_rand(2);
+
+		reg_chan_list_ut_toggle_nol(full, start_chan, end_chan,
+					    nol_chan, nol_history);
+		reg_chan_list_ut_toggle_nol(incr, start_chan, end_chan,
+					    nol_chan, nol_history);
+
+		reg_compute_pdev_current_chan_list(full);
+		reg_compute_pdev_current_chan_list_range(incr, start_chan,
+							 end_chan);
+
+		errors += reg_chan_list_ut_compare(full, incr, i);
+		if (errors)
+			break;
+	}
+
+	qdf_mem_free(incr);
+	qdf_mem_free(full);
+
+	return errors;
+}
+
+/*
+ * Cache the base list for the current config in @stale and mark the live
+ * cache valid, so the next setter has to clear the flag itself.
+ */
+static void
+reg_chan_list_ut_cache_base(struct wlan_regulatory_pdev_priv_obj *pdev_obj,
+			    struct wlan_regulatory_pdev_priv_obj *stale)
+{
+	qdf_mem_copy(stale, pdev_obj, sizeof(*stale));
+	reg_compute_pdev_current_chan_list(stale);
+	pdev_obj->base_chan_list_valid = true;
+}
+
+/*
+ * After @setter changed an override input of the live pdev, rebuild a range
+ * on top of the base list cached before the change and compare it with a
+ * full compute of the new config.
+ */
+static uint32_t
+reg_chan_list_ut_setter_vs_full(struct wlan_regulatory_pdev_priv_obj *pdev_obj,
+				struct wlan_regulatory_pdev_priv_obj *stale,
+				const char *setter)
+{
+	struct wlan_regulatory_pdev_priv_obj *full, *incr;
+	enum channel_enum start_chan, end_chan;
+	uint32_t errors = 0;
+
+	if (pdev_obj->base_chan_list_valid) {
+		qdf_nofl_alert("FAIL: %s left the cached base list valid",
+			       setter);
+		errors++;
+	}
+
+	full = qdf_mem_malloc(sizeof(*full));
+	if (!full)
+		return errors + 1;
+
+	incr = qdf_mem_malloc(sizeof(*incr));
+	if (!incr) {
+		qdf_mem_free(full);
+		return errors + 1;
+	}
+
+	qdf_mem_copy(full, pdev_obj, sizeof(*full));
+	reg_compute_pdev_current_chan_list(full);
+
+	qdf_mem_copy(incr, pdev_obj, sizeof(*incr));
+	qdf_mem_copy(incr->base_chan_list, stale->base_chan_list,
+		     sizeof(incr->base_chan_list));
+	qdf_mem_copy(incr->cur_chan_list, stale->cur_chan_list,
+		     sizeof(incr->cur_chan_list));
+#ifdef FEATURE_WLAN_CH_AVOID_EXT
+	incr->base_avoid_chan_ext_active = stale->base_avoid_chan_ext_active;
+#endif
+
+	start_chan = reg_chan_list_ut_rand(MIN_6GHZ_CHANNEL);
+	end_chan = QDF_MIN(start_chan +
+			   reg_chan_list_ut_rand(reg_chan_list_ut_max_span),
+			   MIN_6GHZ_CHANNEL - 1);
+	reg_compute_pdev_current_chan_list_range(incr, start_chan, end_chan);
+
+	if (reg_chan_list_ut_compare(full, incr, 0)) {
+		qdf_nofl_alert("FAIL: range rebuild after %s is stale", setter);
+		errors++;
+	}
+
+	qdf_mem_free(incr);
+	qdf_mem_free(full);
+
+	return errors;
+}
+
+#ifdef CONFIG_REG_CLIENT
+#define reg_chan_list_ut_vdev_id 0xfe
+
+static uint32_t
+reg_chan_list_ut_indoor_concurrency(struct wlan_objmgr_pdev *pdev,
+				    struct wlan_regulatory_pdev_priv_obj
+				    *pdev_obj,
+				    struct wlan_regulatory_pdev_priv_obj *stale)
+{
+	qdf_freq_t freq = pdev_obj->cur_chan_list[MIN_5GHZ_CHANNEL].center_freq;
+	uint32_t errors = 0;
+
+	reg_chan_list_ut_cache_base(pdev_obj, stale);
+	if (QDF_IS_STATUS_ERROR(reg_add_indoor_concurrency(
+				pdev, reg_chan_list_ut_vdev_id, freq,
+				CH_WIDTH_20MHZ))) {
+		qdf_nofl_info("SKIP: indoor concurrency list is full");
+		return 0;
+	}
+	errors += reg_chan_list_ut_setter_vs_full(pdev_obj, stale,
+						  "reg_add_indoor_concurrency");
+
+	reg_chan_list_ut_cache_base(pdev_obj, stale);
+	reg_remove_indoor_concurrency(pdev, reg_chan_list_ut_vdev_id, freq);
+	errors += reg_chan_list_ut_setter_vs_full(
+			pdev_obj, stale, "reg_remove_indoor_concurrency");
+
+	return errors;
+}
+#else
+static inline uint32_t
+reg_chan_list_ut_indoor_concurrency(struct wlan_objmgr_pdev *pdev,
+				    struct wlan_regulatory_pdev_priv_obj
+				    *pdev_obj,
+				    struct wlan_regulatory_pdev_priv_obj *stale)
+{
+	return 0;
+}
+#endif
+
+#ifdef CONFIG_BAND_6GHZ
+static uint32_t
+reg_chan_list_ut_6g_ap_pwr_type(struct wlan_objmgr_pdev *pdev,
+				struct wlan_regulatory_pdev_priv_obj *pdev_obj,
+				struct wlan_regulatory_pdev_priv_obj *stale)
+{
+	enum reg_6g_ap_type old_type, new_type;
+	uint32_t errors;
+
+	reg_get_cur_6g_ap_pwr_type(pdev, &old_type);
+	new_type = old_type == REG_INDOOR_AP ? REG_VERY_LOW_POWER_AP :
+					       REG_INDOOR_AP;
+
+	reg_chan_list_ut_cache_base(pdev_obj, stale);
+	reg_set_cur_6g_ap_pwr_type(pdev, new_type);
+	errors = reg_chan_list_ut_setter_vs_full(pdev_obj, stale,
+						 "reg_set_cur_6g_ap_pwr_type");
+	reg_set_cur_6g_ap_pwr_type(pdev, old_type);
+
+	return errors;
+}
+#else
+static inline uint32_t
+reg_chan_list_ut_6g_ap_pwr_type(struct wlan_objmgr_pdev *pdev,
+				struct wlan_regulatory_pdev_priv_obj *pdev_obj,
+				struct wlan_regulatory_pdev_priv_obj *stale)
+{
+	return 0;
+}
+#endif
+
+#if defined(DISABLE_CHANNEL_LIST) && defined(CONFIG_CHAN_FREQ_API)
+static uint32_t
+reg_chan_list_ut_cache_chan_state(struct wlan_objmgr_pdev *pdev,
+				  struct wlan_regulatory_pdev_priv_obj
+				  *pdev_obj,
+				  struct wlan_regulatory_pdev_priv_obj *stale)
+{
+	struct regulatory_channel *saved_list;
+	uint32_t saved_num, freq;
+	uint32_t errors;
+
+	saved_list = qdf_mem_malloc(sizeof(pdev_obj->cache_disable_chan_list));
+	if (!saved_list)
+		return 1;
+
+	qdf_mem_copy(saved_list, pdev_obj->cache_disable_chan_list,
+		     sizeof(pdev_obj->cache_disable_chan_list));
+	saved_num = pdev_obj->num_cache_channels;
+	freq = pdev_obj->cur_chan_list[MIN_5GHZ_CHANNEL].center_freq;
+
+	reg_chan_list_ut_cache_base(pdev_obj, stale);
+	reg_cache_channel_freq_state(pdev, &freq, 1);
+	errors = reg_chan_list_ut_setter_vs_full(
+			pdev_obj, stale, "reg_cache_channel_freq_state");
+
+	qdf_mem_copy(pdev_obj->cache_disable_chan_list, saved_list,
+		     sizeof(pdev_obj->cache_disable_chan_list));
+	pdev_obj->num_cache_channels = saved_num;
+	qdf_mem_free(saved_list);
+
+	return errors;
+}
+#else
+static inline uint32_t
+reg_chan_list_ut_cache_chan_state(struct wlan_objmgr_pdev *pdev,
+				  struct wlan_regulatory_pdev_priv_obj
+				  *pdev_obj,
+				  struct wlan_regulatory_pdev_priv_obj *stale)
+{
+	return 0;
+}
+#endif
+
+/*
+ * Drive the setters that change an override input without recomputing the
+ * channel list. The live config is restored afterwards, and so is the cache
+ * flag, since restoring the inputs makes the cached base list match again.
+ * reg_program_chan_list() is left out as it programs the country to FW.
+ */
+static uint32_t
+reg_chan_list_ut_setters_vs_full(struct wlan_objmgr_pdev *pdev,
+				 struct wlan_regulatory_pdev_priv_obj *pdev_obj)
+{
+	struct wlan_regulatory_pdev_priv_obj *stale;
+	bool base_valid = pdev_obj->base_chan_list_valid;
+	uint32_t errors = 0;
+
+	stale = qdf_mem_malloc(sizeof(*stale));
+	if (!stale)
+		return 1;
+
+	errors += reg_chan_list_ut_indoor_concurrency(pdev, pdev_obj, stale);
+	errors += reg_chan_list_ut_6g_ap_pwr_type(pdev, pdev_obj, stale);
+	errors += reg_chan_list_ut_cache_chan_state(pdev, pdev_obj, stale);
+
+	pdev_obj->base_chan_list_valid = base_valid;
+	qdf_mem_free(stale);
+
+	return errors;
+}
+
+uint32_t reg_chan_list_unit_test(void)
+{
+	struct wlan_objmgr_psoc *psoc;
+	struct wlan_objmgr_pdev *pdev;
+	struct wlan_regulatory_pdev_priv_obj *pdev_obj;
+	uint32_t errors = 0;
+
+	psoc = wlan_objmgr_get_psoc_by_id(0, WLAN_REGULATORY_NB_ID);
+	if (!psoc) {
+		qdf_nofl_alert("FAIL: no psoc to run the test on");
+		return 1;
+	}
+
+	pdev = wlan_objmgr_get_pdev_by_id(psoc, 0, WLAN_REGULATORY_NB_ID);
+	if (!pdev) {
+		qdf_nofl_alert("FAIL: no pdev to run the test on");
+		wlan_objmgr_psoc_release_ref(psoc, WLAN_REGULATORY_NB_ID);
+		return 1;
+	}
+
+	pdev_obj = reg_get_pdev_obj(pdev);
+	if (pdev_obj) {
+		errors += reg_chan_list_ut_range_vs_full(pdev_obj);
+		errors += reg_chan_list_ut_setters_vs_full(pdev, pdev_obj);
+	} else {
+		errors++;
+	}
+
+	wlan_objmgr_pdev_release_ref(pdev, WLAN_REGULATORY_NB_ID);
+	wlan_objmgr_psoc_release_ref(psoc, WLAN_REGULATORY_NB_ID);
+
+	return errors;
+}
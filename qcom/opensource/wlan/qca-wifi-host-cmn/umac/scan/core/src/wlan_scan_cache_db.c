@@ -19,11 +19,12 @@
 
 /*
  * DOC: contains scan cache api and functionality
- * The Scan entries are protected by scan_db_lock. Holding the lock
- * for whole scan operation during get/flush scan results may take
- * more than 5 ms and thus ref count is used along with scan_db_lock.
- * Below are the operation on scan cache entry:
- * - While adding new node to the entry scan_db_lock is taken and ref_cnt
+ * The Scan entries are protected by the scan_hash_lock of the bucket their
+ * BSSID hashes to, so beacon ingest only contends with walkers of the same
+ * bucket. Holding the lock for whole scan operation during get/flush scan
+ * results may take more than 5 ms and thus ref count is used along with
+ * the bucket lock. Below are the operation on scan cache entry:
+ * - While adding new node to the entry the bucket lock is taken and ref_cnt
  *   is initialized and incremented. Also the cookie will be set to valid value.
  * - The ref count incremented during adding new node should be decremented only
  *   by a delete operation on the node. But there can be multiple concurrent
@@ -57,6 +58,33 @@
 #include "wlan_crypto_global_api.h"
 #include "wlan_cm_bss_score_param.h"
 
+/**
+ * scm_list_lock() - lock of a scan hash bucket
+ * @scan_db: scan database
+ * @list: hash list of @scan_db
+ *
+ * Return: bucket lock
+ */
+static inline qdf_spinlock_t *scm_list_lock(struct scan_dbs *scan_db,
+					    qdf_list_t *list)
+{
+	return &scan_db->scan_hash_lock[list - scan_db->scan_hash_tbl];
+}
+
+/**
+ * scm_node_lock() - lock of the bucket a scan node is hashed to
+ * @scan_db: scan database
+ * @scan_node: scan node
+ *
+ * Return: bucket lock
+ */
+static inline qdf_spinlock_t *scm_node_lock(struct scan_dbs *scan_db,
+					    struct scan_cache_node *scan_node)
+{
+	return &scan_db->scan_hash_lock[
+			SCAN_GET_HASH(scan_node->entry->bssid.bytes)];
+}
+
 #ifdef FEATURE_6G_SCAN_CHAN_SORT_ALGO
 
 struct channel_list_db *scm_get_rnr_channel_db(struct wlan_objmgr_psoc *psoc)
@@ -225,7 +253,7 @@ void scm_filter_rnr_flag_pno(struct wlan_objmgr_vdev *vdev,
  * @list: hash list
  * @scan_node: node to be removed
  *
- * This should be called while holding scan_db_lock.
+ * This should be called while holding the bucket lock.
  *
  * Return: void
  */
@@ -247,7 +275,7 @@ static void scm_del_scan_node(qdf_list_t *list,
  * @scan_entry:entry scan_node
  *
  * API to flush the scan entry. This should be called while
- * holding scan_db_lock.
+ * holding the bucket lock of @scan_node.
  *
  * Return: QDF status.
  */
@@ -255,14 +283,14 @@ static QDF_STATUS scm_del_scan_node_from_db(struct scan_dbs *scan_db,
 	struct scan_cache_node *scan_node)
 {
 	QDF_STATUS status = QDF_STATUS_SUCCESS;
-	uint8_t hash_idx;
+	uint32_t hash_idx;
 
 	if (!scan_node)
 		return QDF_STATUS_E_INVAL;
 
 	hash_idx = SCAN_GET_HASH(scan_node->entry->bssid.bytes);
 	scm_del_scan_node(&scan_db->scan_hash_tbl[hash_idx], scan_node);
-	scan_db->num_entries--;
+	qdf_atomic_dec(&scan_db->num_entries);
 
 	return status;
 }
@@ -288,13 +316,14 @@ static void scm_scan_entry_get_ref(struct scan_cache_node *scan_node)
  * and free if it become 0
  * @scan_db: scan database
  * @scan_node: scan node
- * @lock_needed: if scan_db_lock is needed
+ * @lock_needed: if the bucket lock is needed
  *
  * Return: void
  */
 static void scm_scan_entry_put_ref(struct scan_dbs *scan_db,
 	struct scan_cache_node *scan_node, bool lock_needed)
 {
+	qdf_spinlock_t *lock;
 
 	if (!scan_node) {
 		scm_err("scan_node is NULL");
@@ -302,12 +331,13 @@ static void scm_scan_entry_put_ref(struct scan_dbs *scan_db,
 		return;
 	}
 
+	lock = scm_node_lock(scan_db, scan_node);
 	if (lock_needed)
-		qdf_spin_lock_bh(&scan_db->scan_db_lock);
+		qdf_spin_lock_bh(lock);
 
 	if (!qdf_atomic_read(&scan_node->ref_cnt)) {
 		if (lock_needed)
-			qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+			qdf_spin_unlock_bh(lock);
 		scm_err("scan_node ref cnt is 0");
 		QDF_ASSERT(0);
 		return;
@@ -318,7 +348,7 @@ static void scm_scan_entry_put_ref(struct scan_dbs *scan_db,
 		scm_del_scan_node_from_db(scan_db, scan_node);
 
 	if (lock_needed)
-		qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+		qdf_spin_unlock_bh(lock);
 }
 
 /**
@@ -326,7 +356,7 @@ static void scm_scan_entry_put_ref(struct scan_dbs *scan_db,
  * @scan_db: data base
  * @scan_node: node to be deleted
  *
- * Call must be protected by scan_db->scan_db_lock
+ * Call must be protected by the bucket lock of @scan_node
  *
  * Return: void
  */
@@ -360,7 +390,7 @@ static void scm_scan_entry_del(struct scan_dbs *scan_db,
  * @dup_node: node before which new node to be added
  * if it's not NULL, otherwise add node to tail
  *
- * Call must be protected by scan_db->scan_db_lock
+ * Call must be protected by the bucket lock of @scan_node
  *
  * Return: void
  */
@@ -368,7 +398,7 @@ static void scm_add_scan_node(struct scan_dbs *scan_db,
 	struct scan_cache_node *scan_node,
 	struct scan_cache_node *dup_node)
 {
-	uint8_t hash_idx;
+	uint32_t hash_idx;
 
 	hash_idx =
 		SCAN_GET_HASH(scan_node->entry->bssid.bytes);
@@ -383,7 +413,7 @@ static void scm_add_scan_node(struct scan_dbs *scan_db,
 		qdf_list_insert_before(&scan_db->scan_hash_tbl[hash_idx],
 				       &scan_node->node, &dup_node->node);
 
-	scan_db->num_entries++;
+	qdf_atomic_inc(&scan_db->num_entries);
 }
 
 
@@ -395,7 +425,7 @@ static void scm_add_scan_node(struct scan_dbs *scan_db,
  *
  * API to get next active node from the list. If cur_node is NULL
  * it will return first node of the list.
- * Call must be protected by scan_db->scan_db_lock
+ * Call must be protected by the bucket lock of @list
  *
  * Return: next scan node
  */
@@ -447,8 +477,9 @@ scm_get_next_node(struct scan_dbs *scan_db,
 {
 	struct scan_cache_node *next_node = NULL;
 	qdf_list_node_t *next_list = NULL;
+	qdf_spinlock_t *lock = scm_list_lock(scan_db, list);
 
-	qdf_spin_lock_bh(&scan_db->scan_db_lock);
+	qdf_spin_lock_bh(lock);
 	if (cur_node) {
 		next_list = scm_get_next_valid_node(list, &cur_node->node);
 		/* Decrement the ref count of the previous node */
@@ -463,7 +494,7 @@ scm_get_next_node(struct scan_dbs *scan_db,
 			struct scan_cache_node, node);
 		scm_scan_entry_get_ref(next_node);
 	}
-	qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+	qdf_spin_unlock_bh(lock);
 
 	return next_node;
 }
@@ -485,9 +516,9 @@ static void scm_check_and_age_out(struct scan_dbs *scan_db,
 		scm_debug("Aging out BSSID: "QDF_MAC_ADDR_FMT" with age %lu ms",
 			  QDF_MAC_ADDR_REF(node->entry->bssid.bytes),
 			  util_scan_entry_age(node->entry));
-		qdf_spin_lock_bh(&scan_db->scan_db_lock);
+		qdf_spin_lock_bh(scm_node_lock(scan_db, node));
 		scm_scan_entry_del(scan_db, node);
-		qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+		qdf_spin_unlock_bh(scm_node_lock(scan_db, node));
 	}
 }
 
@@ -593,6 +624,7 @@ static QDF_STATUS scm_flush_oldest_entry(struct scan_dbs *scan_db)
 	int i;
 	struct scan_cache_node *oldest_node = NULL;
 	struct scan_cache_node *cur_node;
+	qdf_spinlock_t *lock;
 
 	for (i = 0 ; i < SCAN_HASH_SIZE; i++) {
 		/* Get the first valid node for the hash */
@@ -611,10 +643,11 @@ static QDF_STATUS scm_flush_oldest_entry(struct scan_dbs *scan_db)
 					scm_scan_entry_put_ref(scan_db,
 							       oldest_node,
 							       true);
-				qdf_spin_lock_bh(&scan_db->scan_db_lock);
+				lock = scm_node_lock(scan_db, cur_node);
+				qdf_spin_lock_bh(lock);
 				oldest_node = cur_node;
 				scm_scan_entry_get_ref(oldest_node);
-				qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+				qdf_spin_unlock_bh(lock);
 			}
 
 			cur_node = scm_get_next_node(scan_db,
@@ -628,10 +661,11 @@ static QDF_STATUS scm_flush_oldest_entry(struct scan_dbs *scan_db)
 			  QDF_MAC_ADDR_REF(oldest_node->entry->bssid.bytes),
 			  util_scan_entry_age(oldest_node->entry));
 		/* Release ref_cnt taken for oldest_node and delete it */
-		qdf_spin_lock_bh(&scan_db->scan_db_lock);
+		lock = scm_node_lock(scan_db, oldest_node);
+		qdf_spin_lock_bh(lock);
 		scm_scan_entry_del(scan_db, oldest_node);
 		scm_scan_entry_put_ref(scan_db, oldest_node, false);
-		qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+		qdf_spin_unlock_bh(lock);
 	}
 
 	return QDF_STATUS_SUCCESS;
@@ -855,7 +889,7 @@ scm_find_duplicate(struct wlan_objmgr_pdev *pdev,
 		   struct scan_cache_entry *entry,
 		   struct scan_cache_node **dup_node)
 {
-	uint8_t hash_idx;
+	uint32_t hash_idx;
 	struct scan_cache_node *cur_node;
 	struct scan_cache_node *next_node = NULL;
 
@@ -949,7 +983,7 @@ static QDF_STATUS scm_add_update_entry(struct wlan_objmgr_psoc *psoc,
 	if (scan_obj->cb.inform_beacon)
 		scan_obj->cb.inform_beacon(pdev, scan_params);
 
-	if (scan_db->num_entries >= MAX_SCAN_CACHE_SIZE) {
+	if (qdf_atomic_read(&scan_db->num_entries) >= MAX_SCAN_CACHE_SIZE) {
 		status = scm_flush_oldest_entry(scan_db);
 		if (QDF_IS_STATUS_ERROR(status)) {
 			/* release ref taken for dup node */
@@ -968,7 +1002,8 @@ static QDF_STATUS scm_add_update_entry(struct wlan_objmgr_psoc *psoc,
 	}
 
 	scan_node->entry = scan_params;
-	qdf_spin_lock_bh(&scan_db->scan_db_lock);
+	/* dup_node has the same BSSID and thus shares the bucket lock */
+	qdf_spin_lock_bh(scm_node_lock(scan_db, scan_node));
 	scm_add_scan_node(scan_db, scan_node, dup_node);
 
 	if (is_dup_found) {
@@ -976,7 +1011,7 @@ static QDF_STATUS scm_add_update_entry(struct wlan_objmgr_psoc *psoc,
 		scm_scan_entry_del(scan_db, dup_node);
 		scm_scan_entry_put_ref(scan_db, dup_node, false);
 	}
-	qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+	qdf_spin_unlock_bh(scm_node_lock(scan_db, scan_node));
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -1499,9 +1534,9 @@ scm_scan_apply_filter_flush_entry(struct wlan_objmgr_psoc *psoc,
 	if (!match)
 		return QDF_STATUS_SUCCESS;
 
-	qdf_spin_lock_bh(&scan_db->scan_db_lock);
+	qdf_spin_lock_bh(scm_node_lock(scan_db, db_node));
 	scm_scan_entry_del(scan_db, db_node);
-	qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+	qdf_spin_unlock_bh(scm_node_lock(scan_db, db_node));
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -1590,9 +1625,9 @@ static void scm_filter_channels(struct wlan_objmgr_pdev *pdev,
 	}
 
 	if (!match) {
-		qdf_spin_lock_bh(&scan_db->scan_db_lock);
+		qdf_spin_lock_bh(scm_node_lock(scan_db, db_node));
 		scm_scan_entry_del(scan_db, db_node);
-		qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+		qdf_spin_unlock_bh(scm_node_lock(scan_db, db_node));
 	}
 }
 
@@ -1681,11 +1716,12 @@ QDF_STATUS scm_db_init(struct wlan_objmgr_psoc *psoc)
 			scm_err("scan_db is NULL %d", i);
 			continue;
 		}
-		scan_db->num_entries = 0;
-		qdf_spinlock_create(&scan_db->scan_db_lock);
-		for (j = 0; j < SCAN_HASH_SIZE; j++)
+		qdf_atomic_init(&scan_db->num_entries);
+		for (j = 0; j < SCAN_HASH_SIZE; j++) {
+			qdf_spinlock_create(&scan_db->scan_hash_lock[j]);
 			qdf_list_create(&scan_db->scan_hash_tbl[j],
 				MAX_SCAN_CACHE_SIZE);
+		}
 	}
 	return QDF_STATUS_SUCCESS;
 }
@@ -1709,9 +1745,10 @@ QDF_STATUS scm_db_deinit(struct wlan_objmgr_psoc *psoc)
 		}
 
 		scm_flush_scan_entries(psoc, scan_db, NULL);
-		for (j = 0; j < SCAN_HASH_SIZE; j++)
+		for (j = 0; j < SCAN_HASH_SIZE; j++) {
 			qdf_list_destroy(&scan_db->scan_hash_tbl[j]);
-		qdf_spinlock_destroy(&scan_db->scan_db_lock);
+			qdf_spinlock_destroy(&scan_db->scan_hash_lock[j]);
+		}
 	}
 
 	return QDF_STATUS_SUCCESS;
@@ -1860,7 +1897,7 @@ void scm_update_rnr_from_scan_cache(struct wlan_objmgr_pdev *pdev)
 QDF_STATUS scm_update_scan_mlme_info(struct wlan_objmgr_pdev *pdev,
 	struct scan_cache_entry *entry)
 {
-	uint8_t hash_idx;
+	uint32_t hash_idx;
 	struct scan_dbs *scan_db;
 	struct scan_cache_node *cur_node;
 	struct scan_cache_node *next_node = NULL;
@@ -1886,9 +1923,9 @@ QDF_STATUS scm_update_scan_mlme_info(struct wlan_objmgr_pdev *pdev,
 		if (util_is_scan_entry_match(entry,
 					cur_node->entry)) {
 			/* Acquire db lock to prevent simultaneous update */
-			qdf_spin_lock_bh(&scan_db->scan_db_lock);
+			qdf_spin_lock_bh(scm_node_lock(scan_db, cur_node));
 			scm_update_mlme_info(entry, cur_node->entry);
-			qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+			qdf_spin_unlock_bh(scm_node_lock(scan_db, cur_node));
 			scm_scan_entry_put_ref(scan_db,
 					cur_node, true);
 			return QDF_STATUS_SUCCESS;
@@ -1904,7 +1941,8 @@ QDF_STATUS scm_update_scan_mlme_info(struct wlan_objmgr_pdev *pdev,
 QDF_STATUS scm_scan_update_mlme_by_bssinfo(struct wlan_objmgr_pdev *pdev,
 		struct bss_info *bss_info, struct mlme_info *mlme)
 {
-	uint8_t hash_idx;
+	uint32_t hash_idx;
+	qdf_spinlock_t *lock;
 	struct scan_dbs *scan_db;
 	struct scan_cache_node *cur_node;
 	struct scan_cache_node *next_node = NULL;
@@ -1931,12 +1969,13 @@ QDF_STATUS scm_scan_update_mlme_by_bssinfo(struct wlan_objmgr_pdev *pdev,
 			(util_is_ssid_match(&bss_info->ssid, &entry->ssid)) &&
 			(bss_info->freq == entry->channel.chan_freq)) {
 			/* Acquire db lock to prevent simultaneous update */
-			qdf_spin_lock_bh(&scan_db->scan_db_lock);
+			lock = scm_node_lock(scan_db, cur_node);
+			qdf_spin_lock_bh(lock);
 			qdf_mem_copy(&entry->mlme_info, mlme,
 					sizeof(struct mlme_info));
 			scm_scan_entry_put_ref(scan_db,
 					cur_node, false);
-			qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+			qdf_spin_unlock_bh(lock);
 			return QDF_STATUS_SUCCESS;
 		}
 		next_node = scm_get_next_node(scan_db,
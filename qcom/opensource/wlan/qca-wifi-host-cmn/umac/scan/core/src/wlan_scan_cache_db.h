@@ -30,23 +30,45 @@
 #include <wlan_objmgr_vdev_obj.h>
 #include <wlan_scan_public_structs.h>
 
-#define SCAN_HASH_SIZE 64
-#define SCAN_GET_HASH(addr) \
-	(((const uint8_t *)(addr))[QDF_MAC_ADDR_SIZE - 1] % SCAN_HASH_SIZE)
+#define SCAN_HASH_BITS 8
+#define SCAN_HASH_SIZE (1 << SCAN_HASH_BITS)
+#define SCAN_GET_HASH(addr) scm_get_hash((const uint8_t *)(addr))
 
 #define ADJACENT_CHANNEL_RSSI_THRESHOLD -80
 
 /**
  * struct scan_dbs - scan cache data base definition
  * @num_entries: number of scan entries
+ * @scan_hash_lock: per bucket lock protecting scan_hash_tbl[] and the
+ *  cookie/ref_cnt transitions of the nodes hashed to it
  * @scan_hash_tbl: link list of bssid hashed scan cache entries for a pdev
  */
 struct scan_dbs {
-	uint32_t num_entries;
-	qdf_spinlock_t scan_db_lock;
+	qdf_atomic_t num_entries;
+	qdf_spinlock_t scan_hash_lock[SCAN_HASH_SIZE];
 	qdf_list_t scan_hash_tbl[SCAN_HASH_SIZE];
 };
 
+/**
+ * scm_get_hash() - hash a BSSID into the scan cache
+ * @addr: BSSID
+ *
+ * BSSIDs of one vendor share the OUI and often differ only in a few low
+ * bits, so mix the whole address rather than its last byte.
+ *
+ * Return: bucket index
+ */
+static inline uint32_t scm_get_hash(const uint8_t *addr)
+{
+	uint32_t val;
+
+	val = ((uint32_t)addr[2] << 24 | (uint32_t)addr[3] << 16 |
+	       (uint32_t)addr[4] << 8 | addr[5]) ^
+	      ((uint32_t)addr[0] << 8 | addr[1]);
+
+	return (val * 0x9E3779B1) >> (32 - SCAN_HASH_BITS);
+}
+
 /**
  * struct scan_bcn_probe_event - beacon/probe info
  * @frm_type: frame type
@@ -26,6 +26,7 @@
 #include <linux/vmalloc.h>
 #include <wlan_logging_sock_svc.h>
 #include <linux/kthread.h>
+#include <linux/percpu.h>
 #if (LINUX_VERSION_CODE >= KERNEL_VERSION(5, 14, 0))
 #include <linux/panic_notifier.h>
 #endif
@@ -138,6 +139,8 @@ struct log_msg {
 	unsigned int index;
 	/* indicates the current filled log length in logbuf */
 	unsigned int filled_length;
+	/* timestamp of the first log in logbuf */
+	uint64_t ts;
 	/*
 	 * Buf to hold the log msg
 	 * tAniHdr + log
@@ -178,7 +181,7 @@ struct wlan_logging {
 	/* Number of buffers to be used for logging */
 	uint32_t num_buf;
 	uint32_t buffer_length;
-	/* Lock to synchronize access to shared logging resource */
+	/* Lock to synchronize access to free/filled/panic lists */
 	spinlock_t spin_lock;
 	/* Holds the free node which can be used for filling logs */
 	struct list_head free_list;
@@ -196,8 +199,6 @@ struct wlan_logging {
 	bool exit;
 	/* Holds number of dropped logs */
 	unsigned int drop_count;
-	/* current logbuf to which the log will be filled to */
-	struct log_msg *pcur_node;
 	/* Event flag used for wakeup and post indication*/
 	unsigned long eventFlag;
 	/* Indicates logger thread is activated */
@@ -219,10 +220,24 @@ struct wlan_logging {
 	qdf_event_t flush_log_completion;
 };
 
+/**
+ * struct wlan_logging_cpu - per CPU log staging buffer
+ * @lock: serializes the owning CPU with flushes issued from other CPUs,
+ *  only contended while a flush or panic dump is in progress
+ * @pcur_node: current logbuf to which this CPU's logs are filled to
+ * @contention_count: number of times a log found @lock taken
+ */
+struct wlan_logging_cpu {
+	spinlock_t lock;
+	struct log_msg *pcur_node;
+	unsigned int contention_count;
+};
+
 /* This global variable is intentionally not marked static because it
  * is used by offline tools. Please do not use it outside this file.
  */
 struct wlan_logging gwlan_logging;
+DEFINE_PER_CPU(struct wlan_logging_cpu, gwlan_logging_cpu);
 static struct pkt_stats_msg *gpkt_stats_buffers;
 
 #ifdef WLAN_LOGGING_BUFFERS_DYNAMICALLY
@@ -258,23 +273,43 @@ static inline void free_log_msg_buffer(void)
 #endif
 
 /* Need to call this with spin_lock acquired */
-static int wlan_queue_logmsg_for_app(void)
+static void wlan_add_filled_logmsg(struct log_msg *plog_msg)
+{
+	struct log_msg *pos;
+
+	/*
+	 * Merge the per CPU buffers by the timestamp of their first line.
+	 * Lines of buffers from different CPUs may still interleave in time,
+	 * wlan_queue_stale_logmsg_for_app() only keeps a partial buffer from
+	 * being held back behind newer ones. Buffers are mostly queued in
+	 * order, so this rarely walks past the tail.
+	 */
+	list_for_each_entry_reverse(pos, &gwlan_logging.filled_list, node) {
+		if (pos->ts <= plog_msg->ts) {
+			list_add(&plog_msg->node, &pos->node);
+			return;
+		}
+	}
+	list_add(&plog_msg->node, &gwlan_logging.filled_list);
+}
+
+/* Need to call this with spin_lock and the lock of cpu_log acquired */
+static int wlan_queue_logmsg_for_app(struct wlan_logging_cpu *cpu_log)
 {
 	char *ptr;
 	int ret = 0;
-	ptr = &gwlan_logging.pcur_node->logbuf[sizeof(tAniHdr)];
-	ptr[gwlan_logging.pcur_node->filled_length] = '\0';
+	ptr = &cpu_log->pcur_node->logbuf[sizeof(tAniHdr)];
+	ptr[cpu_log->pcur_node->filled_length] = '\0';
 
-	*(unsigned short *)(gwlan_logging.pcur_node->logbuf) =
+	*(unsigned short *)(cpu_log->pcur_node->logbuf) =
 		ANI_NL_MSG_LOG_TYPE;
-	*(unsigned short *)(gwlan_logging.pcur_node->logbuf + 2) =
-		gwlan_logging.pcur_node->filled_length;
-	list_add_tail(&gwlan_logging.pcur_node->node,
-		      &gwlan_logging.filled_list);
+	*(unsigned short *)(cpu_log->pcur_node->logbuf + 2) =
+		cpu_log->pcur_node->filled_length;
+	wlan_add_filled_logmsg(cpu_log->pcur_node);
 
 	if (!list_empty(&gwlan_logging.free_list)) {
 		/* Get buffer from free list */
-		gwlan_logging.pcur_node =
+		cpu_log->pcur_node =
 			(struct log_msg *)(gwlan_logging.free_list.next);
 		list_del_init(gwlan_logging.free_list.next);
 	} else if (!list_empty(&gwlan_logging.filled_list)) {
@@ -282,7 +317,7 @@ static int wlan_queue_logmsg_for_app(void)
 		/* This condition will drop the packet from being
 		 * indicated to app
 		 */
-		gwlan_logging.pcur_node =
+		cpu_log->pcur_node =
 			(struct log_msg *)(gwlan_logging.filled_list.next);
 		++gwlan_logging.drop_count;
 		list_del_init(gwlan_logging.filled_list.next);
@@ -290,10 +325,76 @@ static int wlan_queue_logmsg_for_app(void)
 	}
 
 	/* Reset the current node values */
-	gwlan_logging.pcur_node->filled_length = 0;
+	cpu_log->pcur_node->filled_length = 0;
 	return ret;
 }
 
+/**
+ * wlan_queue_cpu_logmsg_for_app() - queue the partially filled log buffers
+ *  of all CPUs
+ * @max_ts: only queue buffers whose first line is not newer than this
+ * @can_block: wait for a CPU lock, else skip a CPU whose lock is taken
+ *
+ * Return: None
+ */
+static void wlan_queue_cpu_logmsg_for_app(uint64_t max_ts, bool can_block)
+{
+	struct wlan_logging_cpu *cpu_log;
+	unsigned long flags;
+	int cpu;
+
+	for_each_possible_cpu(cpu) {
+		cpu_log = per_cpu_ptr(&gwlan_logging_cpu, cpu);
+		if (can_block)
+			spin_lock_irqsave(&cpu_log->lock, flags);
+		else if (!spin_trylock_irqsave(&cpu_log->lock, flags))
+			continue;
+		if (cpu_log->pcur_node && cpu_log->pcur_node->filled_length &&
+		    cpu_log->pcur_node->ts <= max_ts) {
+			spin_lock(&gwlan_logging.spin_lock);
+			wlan_queue_logmsg_for_app(cpu_log);
+			spin_unlock(&gwlan_logging.spin_lock);
+		}
+		spin_unlock_irqrestore(&cpu_log->lock, flags);
+	}
+}
+
+static void wlan_queue_all_logmsg_for_app(void)
+{
+	wlan_queue_cpu_logmsg_for_app(U64_MAX, true);
+}
+
+/**
+ * wlan_queue_stale_logmsg_for_app() - queue partial buffers older than the
+ *  newest filled buffer
+ *
+ * A CPU that logs rarely would keep its partial buffer until it fills up,
+ * holding its lines back indefinitely behind newer ones from busy CPUs.
+ * Called by the logger thread before sending, so a partial buffer goes out
+ * no later than the first filled buffer that started after it. A CPU busy
+ * logging is skipped, it is picked up on the next pass.
+ *
+ * Return: None
+ */
+static void wlan_queue_stale_logmsg_for_app(void)
+{
+	struct log_msg *newest;
+	unsigned long flags;
+	uint64_t max_ts;
+
+	spin_lock_irqsave(&gwlan_logging.spin_lock, flags);
+	if (list_empty(&gwlan_logging.filled_list)) {
+		spin_unlock_irqrestore(&gwlan_logging.spin_lock, flags);
+		return;
+	}
+	newest = list_last_entry(&gwlan_logging.filled_list,
+				 struct log_msg, node);
+	max_ts = newest->ts;
+	spin_unlock_irqrestore(&gwlan_logging.spin_lock, flags);
+
+	wlan_queue_cpu_logmsg_for_app(max_ts, false);
+}
+
 static const char *current_process_name(void)
 {
 	if (in_irq())
@@ -400,6 +501,7 @@ int wlan_log_to_user(QDF_TRACE_LEVEL log_level, char *to_be_sent, int length)
 	bool wake_up_thread = false;
 	unsigned long flags;
 	uint64_t ts;
+	struct wlan_logging_cpu *cpu_log;
 
 	/* Add the current time stamp */
 	ts = qdf_get_log_timestamp();
@@ -414,24 +516,34 @@ int wlan_log_to_user(QDF_TRACE_LEVEL log_level, char *to_be_sent, int length)
 	/* 1+1 indicate '\n'+'\0' */
 	total_log_len = length + tlen + 1 + 1;
 
-	spin_lock_irqsave(&gwlan_logging.spin_lock, flags);
+	local_irq_save(flags);
+	cpu_log = this_cpu_ptr(&gwlan_logging_cpu);
+	if (!spin_trylock(&cpu_log->lock)) {
+		cpu_log->contention_count++;
+		spin_lock(&cpu_log->lock);
+	}
 	/* wlan logging svc resources are not yet initialized */
-	if (!gwlan_logging.pcur_node) {
-		spin_unlock_irqrestore(&gwlan_logging.spin_lock, flags);
+	if (!cpu_log->pcur_node) {
+		spin_unlock_irqrestore(&cpu_log->lock, flags);
 		return -EIO;
 	}
 
-	pfilled_length = &gwlan_logging.pcur_node->filled_length;
+	pfilled_length = &cpu_log->pcur_node->filled_length;
 
 	/* Check if we can accommodate more log into current node/buffer */
 	if ((MAX_LOGMSG_LENGTH - (*pfilled_length +
 			sizeof(tAniNlHdr))) < total_log_len) {
 		wake_up_thread = true;
-		wlan_queue_logmsg_for_app();
-		pfilled_length = &gwlan_logging.pcur_node->filled_length;
+		spin_lock(&gwlan_logging.spin_lock);
+		wlan_queue_logmsg_for_app(cpu_log);
+		spin_unlock(&gwlan_logging.spin_lock);
+		pfilled_length = &cpu_log->pcur_node->filled_length;
 	}
 
-	ptr = &gwlan_logging.pcur_node->logbuf[sizeof(tAniHdr)];
+	if (!*pfilled_length)
+		cpu_log->pcur_node->ts = ts;
+
+	ptr = &cpu_log->pcur_node->logbuf[sizeof(tAniHdr)];
 
 	if (unlikely(MAX_LOGMSG_LENGTH < (sizeof(tAniNlHdr) + total_log_len))) {
 		/*
@@ -455,7 +567,7 @@ int wlan_log_to_user(QDF_TRACE_LEVEL log_level, char *to_be_sent, int length)
 	ptr[*pfilled_length] = '\n';
 	*pfilled_length += 1;
 
-	spin_unlock_irqrestore(&gwlan_logging.spin_lock, flags);
+	spin_unlock_irqrestore(&cpu_log->lock, flags);
 
 	/* Wakeup logger thread */
 	if (wake_up_thread) {
@@ -847,7 +959,6 @@ static int wlan_logging_thread(void *Arg)
 {
 	int ret_wait_status = 0;
 	int ret = 0;
-	unsigned long flags;
 
 	while (!gwlan_logging.exit) {
 		setup_flush_timer();
@@ -880,6 +991,7 @@ static int wlan_logging_thread(void *Arg)
 
 		if (test_and_clear_bit(HOST_LOG_DRIVER_MSG,
 					&gwlan_logging.eventFlag)) {
+			wlan_queue_stale_logmsg_for_app();
 			ret = send_filled_buffers_to_user();
 			if (-ENOMEM == ret)
 				msleep(200);
@@ -916,11 +1028,7 @@ static int wlan_logging_thread(void *Arg)
 			} else {
 				gwlan_logging.is_flush_complete = true;
 				/* Flush all current host logs*/
-				spin_lock_irqsave(&gwlan_logging.spin_lock,
-					flags);
-				wlan_queue_logmsg_for_app();
-				spin_unlock_irqrestore(&gwlan_logging.spin_lock,
-					flags);
+				wlan_queue_all_logmsg_for_app();
 				set_bit(HOST_LOG_DRIVER_MSG,
 						&gwlan_logging.eventFlag);
 				set_bit(HOST_LOG_PER_PKT_STATS,
@@ -1044,9 +1152,17 @@ static void wlan_logging_dump_last_logs(void)
 static int wlan_logging_panic_handler(struct notifier_block *this,
 				      unsigned long event, void *ptr)
 {
-	char *log;
 	struct log_msg *plog_msg;
+	struct wlan_logging_cpu *cpu_log;
 	unsigned long flags;
+	int cpu;
+
+	/*
+	 * Queue current nodes of all CPUs. The panicking CPU may have
+	 * interrupted a writer holding its CPU lock, or other CPUs may be
+	 * stopped with theirs held, so skip any CPU whose lock is taken.
+	 */
+	wlan_queue_cpu_logmsg_for_app(U64_MAX, false);
 
 	spin_lock_irqsave(&gwlan_logging.spin_lock, flags);
 	/* Iterate over nodes queued for app */
@@ -1057,24 +1173,15 @@ static int wlan_logging_panic_handler(struct notifier_block *this,
 		list_add_tail(&plog_msg->node,
 			      &gwlan_logging.panic_list);
 	}
-	/* Check current node */
-	if (gwlan_logging.pcur_node &&
-	    gwlan_logging.pcur_node->filled_length) {
-		plog_msg = gwlan_logging.pcur_node;
-		log = &plog_msg->logbuf[sizeof(tAniHdr)];
-		log[plog_msg->filled_length] = '\0';
-		list_add_tail(&gwlan_logging.pcur_node->node,
-			      &gwlan_logging.panic_list);
-		if (!list_empty(&gwlan_logging.free_list)) {
-			gwlan_logging.pcur_node =
-				(struct log_msg *)(gwlan_logging.free_list.next);
-			list_del_init(gwlan_logging.free_list.next);
-			gwlan_logging.pcur_node->filled_length = 0;
-		} else
-			gwlan_logging.pcur_node = NULL;
-	}
 	spin_unlock_irqrestore(&gwlan_logging.spin_lock, flags);
 
+	for_each_possible_cpu(cpu) {
+		cpu_log = per_cpu_ptr(&gwlan_logging_cpu, cpu);
+		if (cpu_log->contention_count)
+			pr_err("wlan logging cpu %d contention %u\n", cpu,
+			       cpu_log->contention_count);
+	}
+
 	wlan_logging_dump_last_logs();
 
 	return NOTIFY_DONE;
@@ -1133,6 +1240,50 @@ static void flush_timer_deinit(void)
 	qdf_spinlock_destroy(&gwlan_logging.flush_timer_lock);
 }
 
+/**
+ * wlan_logging_cpu_init() - hand a log buffer to every CPU
+ *
+ * Return: None
+ */
+static void wlan_logging_cpu_init(void)
+{
+	struct wlan_logging_cpu *cpu_log;
+	unsigned long flags;
+	int cpu;
+
+	for_each_possible_cpu(cpu) {
+		cpu_log = per_cpu_ptr(&gwlan_logging_cpu, cpu);
+		spin_lock_init(&cpu_log->lock);
+		cpu_log->contention_count = 0;
+
+		spin_lock_irqsave(&gwlan_logging.spin_lock, flags);
+		cpu_log->pcur_node = (struct log_msg *)
+				     (gwlan_logging.free_list.next);
+		list_del_init(gwlan_logging.free_list.next);
+		cpu_log->pcur_node->filled_length = 0;
+		spin_unlock_irqrestore(&gwlan_logging.spin_lock, flags);
+	}
+}
+
+/**
+ * wlan_logging_cpu_deinit() - detach the log buffers from all CPUs
+ *
+ * Return: None
+ */
+static void wlan_logging_cpu_deinit(void)
+{
+	struct wlan_logging_cpu *cpu_log;
+	unsigned long flags;
+	int cpu;
+
+	for_each_possible_cpu(cpu) {
+		cpu_log = per_cpu_ptr(&gwlan_logging_cpu, cpu);
+		spin_lock_irqsave(&cpu_log->lock, flags);
+		cpu_log->pcur_node = NULL;
+		spin_unlock_irqrestore(&cpu_log->lock, flags);
+	}
+}
+
 int wlan_logging_sock_init_svc(void)
 {
 	int i = 0, j, pkt_stats_size;
@@ -1146,6 +1297,13 @@ int wlan_logging_sock_init_svc(void)
 	gwlan_logging.num_buf = MAX_LOGMSG_COUNT;
 	gwlan_logging.buffer_length = MAX_LOGMSG_LENGTH;
 
+	/* every CPU holds one buffer, leave some to queue for app */
+	if (num_possible_cpus() * 2 > gwlan_logging.num_buf) {
+		qdf_err("Too many CPUs %u for %u log buffers",
+			num_possible_cpus(), gwlan_logging.num_buf);
+		return -EINVAL;
+	}
+
 	if (allocate_log_msg_buffer() != QDF_STATUS_SUCCESS) {
 		qdf_err("Could not allocate memory for log_msg");
 		return -ENOMEM;
@@ -1160,10 +1318,8 @@ int wlan_logging_sock_init_svc(void)
 		list_add(&gplog_msg[i].node, &gwlan_logging.free_list);
 		gplog_msg[i].index = i;
 	}
-	gwlan_logging.pcur_node = (struct log_msg *)
-				  (gwlan_logging.free_list.next);
-	list_del_init(gwlan_logging.free_list.next);
 	spin_unlock_irqrestore(&gwlan_logging.spin_lock, irq_flag);
+	wlan_logging_cpu_init();
 
 	flush_timer_init();
 
@@ -1243,9 +1399,7 @@ err2:
 	gpkt_stats_buffers = NULL;
 err1:
 	flush_timer_deinit();
-	spin_lock_irqsave(&gwlan_logging.spin_lock, irq_flag);
-	gwlan_logging.pcur_node = NULL;
-	spin_unlock_irqrestore(&gwlan_logging.spin_lock, irq_flag);
+	wlan_logging_cpu_deinit();
 	free_log_msg_buffer();
 
 	return -ENOMEM;
@@ -1256,7 +1410,7 @@ int wlan_logging_sock_deinit_svc(void)
 	unsigned long irq_flag;
 	int i;
 
-	if (!gwlan_logging.pcur_node)
+	if (!raw_cpu_ptr(&gwlan_logging_cpu)->pcur_node)
 		return 0;
 
 	qdf_event_destroy(&gwlan_logging.flush_log_completion);
@@ -1290,9 +1444,7 @@ int wlan_logging_sock_deinit_svc(void)
 	/* Delete the Flush timer then mark pcur_node NULL */
 	flush_timer_deinit();
 
-	spin_lock_irqsave(&gwlan_logging.spin_lock, irq_flag);
-	gwlan_logging.pcur_node = NULL;
-	spin_unlock_irqrestore(&gwlan_logging.spin_lock, irq_flag);
+	wlan_logging_cpu_deinit();
 
 	free_log_msg_buffer();
 
@@ -1354,13 +1506,9 @@ void wlan_logging_set_fw_flush_complete(void)
  */
 void wlan_flush_host_logs_for_fatal(void)
 {
-	unsigned long flags;
-
 	if (gwlan_logging.flush_timer_period == 0)
 		qdf_info("Flush all host logs Setting HOST_LOG_POST_MAS");
-	spin_lock_irqsave(&gwlan_logging.spin_lock, flags);
-	wlan_queue_logmsg_for_app();
-	spin_unlock_irqrestore(&gwlan_logging.spin_lock, flags);
+	wlan_queue_all_logmsg_for_app();
 	set_bit(HOST_LOG_DRIVER_MSG, &gwlan_logging.eventFlag);
 	wake_up_interruptible(&gwlan_logging.wait_queue);
 }
@@ -48,6 +48,21 @@ struct wbuff_alloc_request {
 	uint16_t size;
 };
 
+/**
+ * struct wbuff_stats - usage counters of a wbuff pool
+ * @hit: requests served from a per CPU cache
+ * @miss: requests which refilled a per CPU cache from the pool
+ * @fallback: requests which found the pool empty and grew it, or left
+ * the allocation to the caller
+ * @pool_size: buffers currently owned by the pool
+ */
+struct wbuff_stats {
+	uint32_t hit;
+	uint32_t miss;
+	uint32_t fallback;
+	uint16_t pool_size;
+};
+
 /* Opaque handle for wbuff */
 struct wbuff_mod_handle;
 
@@ -114,6 +129,18 @@ qdf_nbuf_t wbuff_buff_get(struct wbuff_mod_handle *hdl, uint32_t len,
  */
 qdf_nbuf_t wbuff_buff_put(qdf_nbuf_t buf);
 
+/**
+ * wbuff_get_stats() - get usage counters of a pool
+ * @hdl: wbuff_handle corresponding to the module
+ * @pool: pool slot, WBUFF_POOL_0..WBUFF_POOL_3
+ * @stats: filled with the counters of @pool
+ *
+ * Return: QDF_STATUS_SUCCESS - @stats filled
+ *         QDF_STATUS_E_INVAL - invalid handle or pool
+ */
+QDF_STATUS wbuff_get_stats(struct wbuff_mod_handle *hdl, uint8_t pool,
+			   struct wbuff_stats *stats);
+
 #else
 
 static inline QDF_STATUS wbuff_module_init(void)
@@ -151,5 +178,12 @@ wbuff_buff_put(qdf_nbuf_t buf)
 	return buf;
 }
 
+static inline QDF_STATUS
+wbuff_get_stats(struct wbuff_mod_handle *hdl, uint8_t pool,
+		struct wbuff_stats *stats)
+{
+	return QDF_STATUS_E_NOSUPPORT;
+}
+
 #endif
 #endif /* _WBUFF_H */
@@ -25,6 +25,8 @@
 #define _I_WBUFF_H
 
 #include <qdf_nbuf.h>
+#include <qdf_atomic.h>
+#include <qdf_util.h>
 
 /* Number of modules supported by wbuff */
 #define WBUFF_MAX_MODULES 4
@@ -57,6 +59,15 @@
 #define WBUFF_PSLOT_SHIFT 1
 #define WBUFF_PSLOT_BITMASK 0xE
 
+/* Number of per CPU caches per pool, CPUs beyond this share caches */
+#define WBUFF_MAX_CPUS 8
+
+/* Buffers held by a per CPU cache */
+#define WBUFF_CPU_CACHE_SIZE 8
+
+/* Buffers moved between a per CPU cache and the shared pool at once */
+#define WBUFF_CPU_CACHE_BATCH (WBUFF_CPU_CACHE_SIZE / 2)
+
 /* Comparison array for maximum allocation per pool*/
 uint16_t wbuff_alloc_max[WBUFF_MAX_POOLS] = {WBUFF_POOL_0_MAX,
 					     WBUFF_POOL_1_MAX,
@@ -71,6 +82,21 @@ struct wbuff_handle {
 	uint8_t id;
 };
 
+/**
+ * struct wbuff_cpu_cache - per CPU buffer cache in front of a pool
+ * @lock: Lock for accessing the cache, only contended if the task
+ * migrated or CPUs share the cache
+ * @count: Number of buffers in @buf
+ * @hit: Number of requests served from the cache
+ * @buf: cached buffers
+ */
+struct wbuff_cpu_cache {
+	qdf_spinlock_t lock;
+	uint16_t count;
+	uint32_t hit;
+	qdf_nbuf_t buf[WBUFF_CPU_CACHE_SIZE];
+};
+
 /**
  * struct wbuff_module - allocation holder for wbuff registered module
  * @registered: To identify whether module is registered
@@ -81,15 +107,24 @@ struct wbuff_handle {
  * @reserve: nbuf headroom to start with
  * @align: alignment for the nbuf
  * @pool[]: pools for all available buffers for the module
+ * @pool_size[]: buffers owned by each pool, grows on demand up to
+ * wbuff_alloc_max
+ * @miss[]: requests which had to refill the CPU cache from the pool
+ * @fallback[]: requests which found the pool empty as well
+ * @cache[][]: per CPU caches in front of each pool
  */
 struct wbuff_module {
 	bool registered;
-	uint16_t pending_returns;
+	qdf_atomic_t pending_returns;
 	qdf_spinlock_t lock;
 	struct wbuff_handle handle;
 	int reserve;
 	int align;
 	qdf_nbuf_t pool[WBUFF_MAX_POOLS];
+	uint16_t pool_size[WBUFF_MAX_POOLS];
+	uint32_t miss[WBUFF_MAX_POOLS];
+	uint32_t fallback[WBUFF_MAX_POOLS];
+	struct wbuff_cpu_cache cache[WBUFF_MAX_POOLS][WBUFF_MAX_CPUS];
 };
 
 /**
@@ -170,10 +170,52 @@ static bool wbuff_is_valid_handle(struct wbuff_handle *handle)
 	return false;
 }
 
+/**
+ * wbuff_get_cpu_cache() - get the per CPU cache of a pool
+ * @mod: wbuff module
+ * @pslot: pool slot
+ *
+ * Callers are preemptible, so the CPU is sampled with qdf_get_cpu() and
+ * may be stale by the time the cache is used. The cache is always
+ * accessed under its own lock, so a task migrating in between only costs
+ * a contended lock.
+ *
+ * Return: per CPU cache of @pslot for the current CPU
+ */
+static inline struct wbuff_cpu_cache *
+wbuff_get_cpu_cache(struct wbuff_module *mod, uint8_t pslot)
+{
+	int cpu = qdf_get_cpu();
+
+	return &mod->cache[pslot][cpu % WBUFF_MAX_CPUS];
+}
+
+/**
+ * wbuff_free_cpu_caches() - free all buffers held by the per CPU caches
+ * @mod: wbuff module
+ *
+ * Return: None
+ */
+static void wbuff_free_cpu_caches(struct wbuff_module *mod)
+{
+	struct wbuff_cpu_cache *cache;
+	uint8_t pslot = 0, cpu = 0;
+
+	for (pslot = 0; pslot < WBUFF_MAX_POOLS; pslot++) {
+		for (cpu = 0; cpu < WBUFF_MAX_CPUS; cpu++) {
+			cache = &mod->cache[pslot][cpu];
+			qdf_spin_lock_bh(&cache->lock);
+			while (cache->count)
+				qdf_nbuf_free(cache->buf[--cache->count]);
+			qdf_spin_unlock_bh(&cache->lock);
+		}
+	}
+}
+
 QDF_STATUS wbuff_module_init(void)
 {
 	struct wbuff_module *mod = NULL;
-	uint8_t mslot = 0, pslot = 0;
+	uint8_t mslot = 0, pslot = 0, cpu = 0;
 
 	if (!qdf_nbuf_is_dev_scratch_supported()) {
 		wbuff.initialized = false;
@@ -183,8 +225,13 @@ QDF_STATUS wbuff_module_init(void)
 	for (mslot = 0; mslot < WBUFF_MAX_MODULES; mslot++) {
 		mod = &wbuff.mod[mslot];
 		qdf_spinlock_create(&mod->lock);
-		for (pslot = 0; pslot < WBUFF_MAX_POOLS; pslot++)
+		for (pslot = 0; pslot < WBUFF_MAX_POOLS; pslot++) {
 			mod->pool[pslot] = NULL;
+			for (cpu = 0; cpu < WBUFF_MAX_CPUS; cpu++) {
+				qdf_spinlock_create(&mod->cache[pslot][cpu].lock);
+				mod->cache[pslot][cpu].count = 0;
+			}
+		}
 		mod->registered = false;
 	}
 	wbuff.initialized = true;
@@ -195,7 +242,7 @@ QDF_STATUS wbuff_module_init(void)
 QDF_STATUS wbuff_module_deinit(void)
 {
 	struct wbuff_module *mod = NULL;
-	uint8_t mslot = 0;
+	uint8_t mslot = 0, pslot = 0, cpu = 0;
 
 	if (!wbuff.initialized)
 		return QDF_STATUS_E_INVAL;
@@ -206,6 +253,9 @@ QDF_STATUS wbuff_module_deinit(void)
 		if (mod->registered)
 			wbuff_module_deregister((struct wbuff_mod_handle *)
 						&mod->handle);
+		for (pslot = 0; pslot < WBUFF_MAX_POOLS; pslot++)
+			for (cpu = 0; cpu < WBUFF_MAX_CPUS; cpu++)
+				qdf_spinlock_destroy(&mod->cache[pslot][cpu].lock);
 		qdf_spinlock_destroy(&mod->lock);
 	}
 
@@ -220,7 +270,7 @@ wbuff_module_register(struct wbuff_alloc_request *req, uint8_t num,
 	qdf_nbuf_t buf = NULL;
 	uint32_t len = 0;
 	uint16_t idx = 0, psize = 0;
-	uint8_t alloc = 0, mslot = 0, pslot = 0;
+	uint8_t alloc = 0, mslot = 0, pslot = 0, cpu = 0;
 
 	if (!wbuff.initialized)
 		return NULL;
@@ -238,6 +288,17 @@ wbuff_module_register(struct wbuff_alloc_request *req, uint8_t num,
 	mod = &wbuff.mod[mslot];
 
 	mod->handle.id = mslot;
+	mod->reserve = reserve;
+	mod->align = align;
+	qdf_atomic_init(&mod->pending_returns);
+
+	for (pslot = 0; pslot < WBUFF_MAX_POOLS; pslot++) {
+		mod->pool_size[pslot] = 0;
+		mod->miss[pslot] = 0;
+		mod->fallback[pslot] = 0;
+		for (cpu = 0; cpu < WBUFF_MAX_CPUS; cpu++)
+			mod->cache[pslot][cpu].hit = 0;
+	}
 
 	for (alloc = 0; alloc < num; alloc++) {
 		pslot = req[alloc].slot;
@@ -252,17 +313,11 @@ wbuff_module_register(struct wbuff_alloc_request *req, uint8_t num,
 						 align);
 			if (!buf)
 				continue;
-			if (!mod->pool[pslot]) {
-				qdf_nbuf_set_next(buf, NULL);
-				mod->pool[pslot] = buf;
-			} else {
-				qdf_nbuf_set_next(buf, mod->pool[pslot]);
-				mod->pool[pslot] = buf;
-			}
+			qdf_nbuf_set_next(buf, mod->pool[pslot]);
+			mod->pool[pslot] = buf;
+			mod->pool_size[pslot]++;
 		}
 	}
-	mod->reserve = reserve;
-	mod->align = align;
 
 	return (struct wbuff_mod_handle *)&mod->handle;
 }
@@ -290,21 +345,93 @@ QDF_STATUS wbuff_module_deregister(struct wbuff_mod_handle *hdl)
 			first = qdf_nbuf_next(buf);
 			qdf_nbuf_free(buf);
 		}
+		mod->pool[pslot] = NULL;
 	}
 	mod->registered = false;
 	qdf_spin_unlock_bh(&mod->lock);
 
+	/*
+	 * Buffers put back after this point see the module unregistered
+	 * under the cache lock and are handed back to the caller.
+	 */
+	wbuff_free_cpu_caches(mod);
+
 	return QDF_STATUS_SUCCESS;
 }
 
+/**
+ * wbuff_cache_refill() - move a batch of buffers from the pool to a cache
+ * @mod: wbuff module
+ * @pslot: pool slot
+ * @cache: empty per CPU cache, locked by the caller
+ *
+ * Return: true if the pool may grow by one more buffer, in which case
+ *         pool_size has already been accounted for the caller
+ */
+static bool wbuff_cache_refill(struct wbuff_module *mod, uint8_t pslot,
+			       struct wbuff_cpu_cache *cache)
+{
+	qdf_nbuf_t buf;
+	bool grow = false;
+
+	qdf_spin_lock_bh(&mod->lock);
+	mod->miss[pslot]++;
+	while (mod->pool[pslot] && cache->count < WBUFF_CPU_CACHE_BATCH) {
+		buf = mod->pool[pslot];
+		mod->pool[pslot] = qdf_nbuf_next(buf);
+		cache->buf[cache->count++] = buf;
+	}
+
+	if (!cache->count) {
+		mod->fallback[pslot]++;
+		if (mod->registered &&
+		    mod->pool_size[pslot] < wbuff_alloc_max[pslot]) {
+			mod->pool_size[pslot]++;
+			grow = true;
+		}
+	}
+	qdf_spin_unlock_bh(&mod->lock);
+
+	return grow;
+}
+
+/**
+ * wbuff_cache_flush() - move a batch of buffers from a full cache to the pool
+ * @mod: wbuff module
+ * @pslot: pool slot
+ * @cache: full per CPU cache, locked by the caller
+ *
+ * Return: None
+ */
+static void wbuff_cache_flush(struct wbuff_module *mod, uint8_t pslot,
+			      struct wbuff_cpu_cache *cache)
+{
+	qdf_nbuf_t buf;
+	uint16_t target = cache->count - WBUFF_CPU_CACHE_BATCH;
+
+	qdf_spin_lock_bh(&mod->lock);
+	while (cache->count > target) {
+		buf = cache->buf[--cache->count];
+		if (mod->registered) {
+			qdf_nbuf_set_next(buf, mod->pool[pslot]);
+			mod->pool[pslot] = buf;
+		} else {
+			qdf_nbuf_free(buf);
+		}
+	}
+	qdf_spin_unlock_bh(&mod->lock);
+}
+
 qdf_nbuf_t wbuff_buff_get(struct wbuff_mod_handle *hdl, uint32_t len,
 			  const char *func_name, uint32_t line_num)
 {
 	struct wbuff_handle *handle;
 	struct wbuff_module *mod = NULL;
+	struct wbuff_cpu_cache *cache;
 	uint8_t mslot = 0;
 	uint8_t pslot = 0;
 	qdf_nbuf_t buf = NULL;
+	bool grow = false;
 
 	handle = (struct wbuff_handle *)hdl;
 
@@ -315,15 +442,34 @@ qdf_nbuf_t wbuff_buff_get(struct wbuff_mod_handle *hdl, uint32_t len,
 	mslot = handle->id;
 	pslot = wbuff_get_pool_slot_from_len(len);
 	mod = &wbuff.mod[mslot];
+	cache = wbuff_get_cpu_cache(mod, pslot);
 
-	qdf_spin_lock_bh(&mod->lock);
-	if (mod->pool[pslot]) {
-		buf = mod->pool[pslot];
-		mod->pool[pslot] = qdf_nbuf_next(buf);
-		mod->pending_returns++;
+	qdf_spin_lock_bh(&cache->lock);
+	if (cache->count)
+		cache->hit++;
+	else
+		grow = wbuff_cache_refill(mod, pslot, cache);
+	if (cache->count)
+		buf = cache->buf[--cache->count];
+	qdf_spin_unlock_bh(&cache->lock);
+
+	/*
+	 * Pool and caches are exhausted, size the pool to the demand by
+	 * allocating the buffer here instead of leaving it to the caller.
+	 */
+	if (grow) {
+		buf = wbuff_prepare_nbuf(mslot, pslot,
+					 wbuff_get_len_from_pool_slot(pslot),
+					 mod->reserve, mod->align);
+		if (!buf) {
+			qdf_spin_lock_bh(&mod->lock);
+			mod->pool_size[pslot]--;
+			qdf_spin_unlock_bh(&mod->lock);
+		}
 	}
-	qdf_spin_unlock_bh(&mod->lock);
+
 	if (buf) {
+		qdf_atomic_inc(&mod->pending_returns);
 		qdf_nbuf_set_next(buf, NULL);
 		qdf_net_buf_debug_update_node(buf, func_name, line_num);
 	}
@@ -336,6 +482,8 @@ qdf_nbuf_t wbuff_buff_put(qdf_nbuf_t buf)
 	qdf_nbuf_t buffer = buf;
 	unsigned long slot_info = 0;
 	uint8_t mslot = 0, pslot = 0;
+	struct wbuff_module *mod;
+	struct wbuff_cpu_cache *cache;
 
 	if (!wbuff.initialized)
 		return buffer;
@@ -350,16 +498,48 @@ qdf_nbuf_t wbuff_buff_put(qdf_nbuf_t buf)
 	if (mslot >= WBUFF_MAX_MODULES || pslot >= WBUFF_MAX_POOLS)
 		return NULL;
 
-	qdf_nbuf_reset(buffer, wbuff.mod[mslot].reserve, wbuff.mod[mslot].
-		       align);
-	qdf_spin_lock_bh(&wbuff.mod[mslot].lock);
-	if (wbuff.mod[mslot].registered) {
-		qdf_nbuf_set_next(buffer, wbuff.mod[mslot].pool[pslot]);
-		wbuff.mod[mslot].pool[pslot] = buffer;
-		wbuff.mod[mslot].pending_returns--;
+	mod = &wbuff.mod[mslot];
+	qdf_nbuf_reset(buffer, mod->reserve, mod->align);
+	cache = wbuff_get_cpu_cache(mod, pslot);
+
+	qdf_spin_lock_bh(&cache->lock);
+	if (mod->registered) {
+		if (cache->count == WBUFF_CPU_CACHE_SIZE)
+			wbuff_cache_flush(mod, pslot, cache);
+		qdf_nbuf_set_next(buffer, NULL);
+		cache->buf[cache->count++] = buffer;
+		qdf_atomic_dec(&mod->pending_returns);
 		buffer = NULL;
 	}
-	qdf_spin_unlock_bh(&wbuff.mod[mslot].lock);
+	qdf_spin_unlock_bh(&cache->lock);
 
 	return buffer;
 }
+
+QDF_STATUS wbuff_get_stats(struct wbuff_mod_handle *hdl, uint8_t pool,
+			   struct wbuff_stats *stats)
+{
+	struct wbuff_handle *handle;
+	struct wbuff_module *mod;
+	uint8_t cpu = 0;
+
+	handle = (struct wbuff_handle *)hdl;
+
+	if ((!wbuff.initialized) || (!wbuff_is_valid_handle(handle)) ||
+	    (pool >= WBUFF_MAX_POOLS) || !stats)
+		return QDF_STATUS_E_INVAL;
+
+	mod = &wbuff.mod[handle->id];
+
+	qdf_spin_lock_bh(&mod->lock);
+	stats->miss = mod->miss[pool];
+	stats->fallback = mod->fallback[pool];
+	stats->pool_size = mod->pool_size[pool];
+	qdf_spin_unlock_bh(&mod->lock);
+
+	stats->hit = 0;
+	for (cpu = 0; cpu < WBUFF_MAX_CPUS; cpu++)
+		stats->hit += mod->cache[pool][cpu].hit;
+
+	return QDF_STATUS_SUCCESS;
+}
@@ -3138,6 +3138,7 @@ void wmi_mtrace(uint32_t message_id, uint16_t vdev_id, uint32_t data);
 void wmi_unified_register_module(enum wmi_target_type target_type,
 			void (*wmi_attach)(wmi_unified_t wmi_handle));
 void wmi_tlv_init(void);
+void wmitlv_init_attr_index(void);
 void wmi_non_tlv_init(void);
 #ifdef WMI_NON_TLV_SUPPORT
 /* ONLY_NON_TLV_TARGET:TLV attach dummy function definition for case when
@@ -21,6 +21,7 @@
 #include "wmi_tlv_defs.h"
 #include "wmi_version.h"
 #include "qdf_module.h"
+#include "qdf_util.h"
 
 #define WMITLV_GET_ATTRIB_NUM_TLVS  0xFFFFFFFF
 
@@ -54,6 +55,40 @@ uint32_t evt_attr_list[] = {
 	WMITLV_ALL_EVT_LIST(WMITLV_GET_CMD_EVT_ATTRB_LIST)
 };
 
+/*
+ * Open addressed hash of cmd/evt ID to the index of its WMITLV_SET_ATTRB0
+ * word in cmd_attr_list/evt_attr_list, stored as index + 1 so that 0 marks
+ * an empty slot. Built once by wmitlv_init_attr_index(), lookups fall back
+ * to the linear scan until then.
+ */
+#define WMITLV_ATTR_INDEX_BITS 11
+#define WMITLV_ATTR_INDEX_SIZE (1 << WMITLV_ATTR_INDEX_BITS)
+#define WMITLV_ATTR_INDEX_MASK (WMITLV_ATTR_INDEX_SIZE - 1)
+#define WMITLV_ATTR_INDEX_HASH(id) \
+	((WMITLV_GET_CMDID(id) * 0x9E3779B1) >> (32 - WMITLV_ATTR_INDEX_BITS))
+
+#define WMITLV_COUNT_ID(id) + 1
+
+enum {
+	WMITLV_NUM_CMD_IDS = 0 WMITLV_ALL_CMD_LIST(WMITLV_COUNT_ID),
+	WMITLV_NUM_EVT_IDS = 0 WMITLV_ALL_EVT_LIST(WMITLV_COUNT_ID),
+};
+
+/* keep the load factor at or below 1/2 */
+QDF_COMPILE_TIME_ASSERT(wmitlv_cmd_attr_index_size,
+			2 * WMITLV_NUM_CMD_IDS <= WMITLV_ATTR_INDEX_SIZE);
+QDF_COMPILE_TIME_ASSERT(wmitlv_evt_attr_index_size,
+			2 * WMITLV_NUM_EVT_IDS <= WMITLV_ATTR_INDEX_SIZE);
+/* list offsets are stored in 16 bits */
+QDF_COMPILE_TIME_ASSERT(wmitlv_cmd_attr_list_size,
+			QDF_ARRAY_SIZE(cmd_attr_list) < 0xFFFF);
+QDF_COMPILE_TIME_ASSERT(wmitlv_evt_attr_list_size,
+			QDF_ARRAY_SIZE(evt_attr_list) < 0xFFFF);
+
+static uint16_t cmd_attr_index[WMITLV_ATTR_INDEX_SIZE];
+static uint16_t evt_attr_index[WMITLV_ATTR_INDEX_SIZE];
+static bool wmitlv_attr_index_ready;
+
 #ifdef NO_DYNAMIC_MEM_ALLOC
 static wmitlv_cmd_param_info *g_wmi_static_cmd_param_info_buf;
 uint32_t g_wmi_static_max_cmd_param_tlvs;
@@ -88,6 +123,111 @@ wmitlv_set_static_param_tlv_buf(void *param_tlv_buf,
 #endif
 }
 
+/**
+ * wmitlv_build_attr_index() - fill the ID hash for one attribute list
+ * @attr_list: cmd_attr_list or evt_attr_list
+ * @num_entries: number of words in @attr_list
+ * @index: hash table to fill
+ *
+ * Return: 0 if success, 1 if an ID is listed twice
+ */
+static uint32_t wmitlv_build_attr_index(uint32_t *attr_list,
+					uint32_t num_entries, uint16_t *index)
+{
+	uint32_t i, slot, num_tlvs;
+	uint32_t ret = 0;
+
+	for (i = 0; i < num_entries; i += num_tlvs + 1) {
+		num_tlvs = WMITLV_GET_NUM_TLVS(attr_list[i]);
+		slot = WMITLV_ATTR_INDEX_HASH(attr_list[i]);
+
+		while (index[slot]) {
+			if (WMITLV_GET_CMDID(attr_list[index[slot] - 1]) ==
+			    WMITLV_GET_CMDID(attr_list[i])) {
+				wmi_tlv_print_error
+					("%s: ERROR: duplicate WMI TLV attribute definitions for 0x%x\n",
+					__func__, WMITLV_GET_CMDID(attr_list[i]));
+				ret = 1;
+				break;
+			}
+			slot = (slot + 1) & WMITLV_ATTR_INDEX_MASK;
+		}
+
+		if (!index[slot])
+			index[slot] = i + 1;
+	}
+
+	return ret;
+}
+
+/**
+ * wmitlv_init_attr_index() - build the cmd/evt attribute lookup tables
+ *
+ * Must be called before any WMI traffic, lookups scan the attribute
+ * lists linearly until it has run.
+ *
+ * Return: None
+ */
+void wmitlv_init_attr_index(void)
+{
+	if (wmitlv_attr_index_ready)
+		return;
+
+	wmitlv_build_attr_index(cmd_attr_list, QDF_ARRAY_SIZE(cmd_attr_list),
+				cmd_attr_index);
+	wmitlv_build_attr_index(evt_attr_list, QDF_ARRAY_SIZE(evt_attr_list),
+				evt_attr_index);
+	wmitlv_attr_index_ready = true;
+}
+
+/**
+ * wmitlv_find_attr_base() - locate the attributes of a cmd/evt ID
+ * @is_cmd_id: boolean for command attribute
+ * @cmd_event_id: command event id
+ * @attr_list: attribute list of @cmd_event_id
+ *
+ * Return: index of the WMITLV_SET_ATTRB0 word of @cmd_event_id in
+ * @attr_list, or -1 if the ID has no attribute definitions
+ */
+static int32_t wmitlv_find_attr_base(uint32_t is_cmd_id,
+				     uint32_t cmd_event_id,
+				     uint32_t **attr_list)
+{
+	uint32_t i, slot, num_entries;
+	uint16_t *index;
+
+	if (is_cmd_id) {
+		*attr_list = &cmd_attr_list[0];
+		num_entries = QDF_ARRAY_SIZE(cmd_attr_list);
+		index = cmd_attr_index;
+	} else {
+		*attr_list = &evt_attr_list[0];
+		num_entries = QDF_ARRAY_SIZE(evt_attr_list);
+		index = evt_attr_index;
+	}
+
+	if (qdf_likely(wmitlv_attr_index_ready)) {
+		slot = WMITLV_ATTR_INDEX_HASH(cmd_event_id);
+		while (index[slot]) {
+			i = index[slot] - 1;
+			if (WMITLV_GET_CMDID(cmd_event_id) ==
+			    WMITLV_GET_CMDID((*attr_list)[i]))
+				return i;
+			slot = (slot + 1) & WMITLV_ATTR_INDEX_MASK;
+		}
+		return -1;
+	}
+
+	for (i = 0; i < num_entries;
+	     i += WMITLV_GET_NUM_TLVS((*attr_list)[i]) + 1) {
+		if (WMITLV_GET_CMDID(cmd_event_id) ==
+		    WMITLV_GET_CMDID((*attr_list)[i]))
+			return i;
+	}
+
+	return -1;
+}
+
 /**
  * wmitlv_get_attributes() - tlv helper function
  * @is_cmd_id: boolean for command attribute
@@ -106,73 +246,52 @@ uint32_t wmitlv_get_attributes(uint32_t is_cmd_id, uint32_t cmd_event_id,
 			       uint32_t curr_tlv_order,
 			       wmitlv_attributes_struc *tlv_attr_ptr)
 {
-	uint32_t i, base_index, num_tlvs, num_entries;
+	uint32_t base_index, num_tlvs, attr;
 	uint32_t *pAttrArrayList;
+	int32_t i;
 
-	if (is_cmd_id) {
-		pAttrArrayList = &cmd_attr_list[0];
-		num_entries = QDF_ARRAY_SIZE(cmd_attr_list);
-	} else {
-		pAttrArrayList = &evt_attr_list[0];
-		num_entries = QDF_ARRAY_SIZE(evt_attr_list);
+	i = wmitlv_find_attr_base(is_cmd_id, cmd_event_id, &pAttrArrayList);
+	if (i < 0) {
+		wmi_tlv_print_error
+			("%s: ERROR: Didn't found WMI TLV attribute definitions for %s:0x%x\n",
+			__func__, (is_cmd_id ? "Cmd" : "Evt"), cmd_event_id);
+		return 1;
 	}
 
-	for (i = 0; i < num_entries; i++) {
-		num_tlvs = WMITLV_GET_NUM_TLVS(pAttrArrayList[i]);
-		if (WMITLV_GET_CMDID(cmd_event_id) ==
-		    WMITLV_GET_CMDID(pAttrArrayList[i])) {
-			tlv_attr_ptr->cmd_num_tlv = num_tlvs;
-			/* Return success from here when only number of TLVS for
-			 * this command/event is required */
-			if (curr_tlv_order == WMITLV_GET_ATTRIB_NUM_TLVS) {
-				wmi_tlv_print_verbose
-					("%s: WMI TLV attribute definitions for %s:0x%x found; num_of_tlvs:%d\n",
-					__func__, (is_cmd_id ? "Cmd" : "Evt"),
-					cmd_event_id, num_tlvs);
-				return 0;
-			}
-
-			/* Return failure if tlv_order is more than the expected
-			 * number of TLVs */
-			if (curr_tlv_order >= num_tlvs) {
-				wmi_tlv_print_error
-					("%s: ERROR: TLV order %d greater than num_of_tlvs:%d for %s:0x%x\n",
-					__func__, curr_tlv_order, num_tlvs,
-					(is_cmd_id ? "Cmd" : "Evt"), cmd_event_id);
-				return 1;
-			}
+	num_tlvs = WMITLV_GET_NUM_TLVS(pAttrArrayList[i]);
+	tlv_attr_ptr->cmd_num_tlv = num_tlvs;
+	/* Return success from here when only number of TLVS for
+	 * this command/event is required */
+	if (curr_tlv_order == WMITLV_GET_ATTRIB_NUM_TLVS) {
+		wmi_tlv_print_verbose
+			("%s: WMI TLV attribute definitions for %s:0x%x found; num_of_tlvs:%d\n",
+			__func__, (is_cmd_id ? "Cmd" : "Evt"),
+			cmd_event_id, num_tlvs);
+		return 0;
+	}
 
-			base_index = i + 1;     /* index to first TLV attributes */
-			wmi_tlv_print_verbose
-				("%s: WMI TLV attributes for %s:0x%x tlv[%d]:0x%x\n",
-				__func__, (is_cmd_id ? "Cmd" : "Evt"),
-				cmd_event_id, curr_tlv_order,
-				pAttrArrayList[(base_index + curr_tlv_order)]);
-			tlv_attr_ptr->tag_order = curr_tlv_order;
-			tlv_attr_ptr->tag_id =
-				WMITLV_GET_TAGID(pAttrArrayList
-						 [(base_index + curr_tlv_order)]);
-			tlv_attr_ptr->tag_struct_size =
-				WMITLV_GET_TAG_STRUCT_SIZE(pAttrArrayList
-							   [(base_index +
-							     curr_tlv_order)]);
-			tlv_attr_ptr->tag_varied_size =
-				WMITLV_GET_TAG_VARIED(pAttrArrayList
-						      [(base_index +
-							curr_tlv_order)]);
-			tlv_attr_ptr->tag_array_size =
-				WMITLV_GET_TAG_ARRAY_SIZE(pAttrArrayList
-							  [(base_index +
-							    curr_tlv_order)]);
-			return 0;
-		}
-		i += num_tlvs;
+	/* Return failure if tlv_order is more than the expected
+	 * number of TLVs */
+	if (curr_tlv_order >= num_tlvs) {
+		wmi_tlv_print_error
+			("%s: ERROR: TLV order %d greater than num_of_tlvs:%d for %s:0x%x\n",
+			__func__, curr_tlv_order, num_tlvs,
+			(is_cmd_id ? "Cmd" : "Evt"), cmd_event_id);
+		return 1;
 	}
 
-	wmi_tlv_print_error
-		("%s: ERROR: Didn't found WMI TLV attribute definitions for %s:0x%x\n",
-		__func__, (is_cmd_id ? "Cmd" : "Evt"), cmd_event_id);
-	return 1;
+	base_index = i + 1;     /* index to first TLV attributes */
+	attr = pAttrArrayList[base_index + curr_tlv_order];
+	wmi_tlv_print_verbose
+		("%s: WMI TLV attributes for %s:0x%x tlv[%d]:0x%x\n",
+		__func__, (is_cmd_id ? "Cmd" : "Evt"),
+		cmd_event_id, curr_tlv_order, attr);
+	tlv_attr_ptr->tag_order = curr_tlv_order;
+	tlv_attr_ptr->tag_id = WMITLV_GET_TAGID(attr);
+	tlv_attr_ptr->tag_struct_size = WMITLV_GET_TAG_STRUCT_SIZE(attr);
+	tlv_attr_ptr->tag_varied_size = WMITLV_GET_TAG_VARIED(attr);
+	tlv_attr_ptr->tag_array_size = WMITLV_GET_TAG_ARRAY_SIZE(attr);
+	return 0;
 }
 
 /**
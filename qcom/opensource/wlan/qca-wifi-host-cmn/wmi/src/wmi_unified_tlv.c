@@ -18632,5 +18632,6 @@ qdf_export_symbol(wmi_tlv_attach);
  */
 void wmi_tlv_init(void)
 {
+	wmitlv_init_attr_index();
 	wmi_unified_register_module(WMI_TLV_TARGET, &wmi_tlv_attach);
 }
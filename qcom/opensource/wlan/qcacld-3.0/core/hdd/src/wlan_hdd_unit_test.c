@@ -33,6 +33,7 @@
 #include "qdf_trace.h"
 #include "qdf_tracker_test.h"
 #include "qdf_types_test.h"
+#include "reg_build_chan_list_test.h"
 #include "wlan_dsc_test.h"
 #include "wlan_hdd_unit_test.h"
 
@@ -54,6 +55,7 @@ struct hdd_ut_entry hdd_ut_entries[] = {
 	{ .name = "qdf_talloc", .callback = qdf_talloc_unit_test },
 	{ .name = "qdf_tracker", .callback = qdf_tracker_unit_test },
 	{ .name = "qdf_types", .callback = qdf_types_unit_test },
+	{ .name = "reg_chan_list", .callback = reg_chan_list_unit_test },
 };
 
 #define hdd_for_each_ut_entry(cursor) \